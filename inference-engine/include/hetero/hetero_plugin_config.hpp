@@ -35,5 +35,16 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key to set the number of subgraph infer requests kept per subgraph in a pool that is shared by
+ * all the infer requests of the executable network.
+ * With a non-zero value, different infer requests are pipelined through the subgraphs: a subgraph request is
+ * returned to the pool as soon as the subgraphs consuming its outputs are done, so every device can start
+ * the next infer request while the other devices process the previous ones. Use 2 or more for double buffering.
+ * This option should be used with a non-negative integer value, "0" (default) keeps one subgraph infer request
+ * per subgraph in every infer request.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -11,10 +11,24 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
 
+namespace Metrics {
+
+/**
+ * @brief Metric to get a std::map<std::string, uint64_t> with the number of inference requests dispatched to every
+ * device of the Multi-Device executable network, keyed by the device name
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_DISPATCH_COUNTS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+
 /**
  * @brief Multi Device plugin configuration
  */
@@ -34,5 +48,17 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option that defines how the inference requests are distributed between the devices
+ *
+ * Supported values:
+ *  - MULTI_PRIORITY_ORDER: a request goes to the first device (in the priority order) that has an idle request (default)
+ *  - MULTI_LOWEST_COMPLETION_TIME: a request goes to the device with the lowest predicted completion time,
+ *    estimated from the moving average of the measured device latency and the number of requests in flight
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY_ORDER);
+DECLARE_MULTI_CONFIG_VALUE(LOWEST_COMPLETION_TIME);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
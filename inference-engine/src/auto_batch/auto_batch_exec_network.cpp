@@ -0,0 +1,284 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include <blob_factory.hpp>
+#include <ie_metric_helpers.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include "auto_batch_exec_network.hpp"
+#include "auto_batch_async_infer_request.hpp"
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+// creates the blob that points to the batchId-th sample of the batched blob
+Blob::Ptr CreateSlotBlob(const Blob::Ptr& batchedBlob, const int batchId, const int batchSize) {
+    auto desc = batchedBlob->getTensorDesc();
+    auto dims = desc.getDims();
+    dims[0] = 1;
+    TensorDesc slotDesc{desc.getPrecision(), dims, desc.getLayout()};
+    auto memory = batchedBlob->buffer().as<uint8_t*>();
+    auto slotByteSize = batchedBlob->byteSize() / batchSize;
+    return make_blob_with_precision(slotDesc, memory + batchId * slotByteSize);
+}
+}  // namespace
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const ExecutableNetwork&                                   networkWithBatch,
+                                                       const ExecutableNetwork&                                   networkWithoutBatch,
+                                                       const DeviceInformation&                                   networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                                       const bool                                                 dynamicBatchSupported) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _networkWithBatch{networkWithBatch},
+    _networkWithoutBatch{networkWithoutBatch},
+    _device{networkDevice},
+    _config{config},
+    _dynamicBatchSupported{dynamicBatchSupported} {
+    _timeout = std::chrono::milliseconds{std::stoi(_config.at(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT).as<std::string>())};
+    _timeoutThread = std::thread{[this] { TimeoutLoop(); }};
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _timeoutCondVar.notify_all();
+    if (_timeoutThread.joinable()) {
+        _timeoutThread.join();
+    }
+    /* NOTE: The only threads that use `AutoBatchExecutableNetwork` worker infer requests' threads.
+     *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
+     */
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::StartBatch(WorkerInferRequest& worker, std::vector<AutoBatchInferRequest*> requests) {
+    try {
+        for (std::size_t batchId = 0; batchId < requests.size(); ++batchId) {
+            requests[batchId]->BindToSlot(worker, static_cast<int>(batchId));
+            requests[batchId]->CopyInputsToSlot();
+        }
+        if (_dynamicBatchSupported) {
+            worker._inferRequest.SetBatch(static_cast<int>(requests.size()));
+        }
+        {
+            std::lock_guard<std::mutex> lock(worker._mutex);
+            worker._runningRequests = std::move(requests);
+        }
+        worker._inferRequest.StartAsync();
+    } catch (...) {
+        std::vector<AutoBatchInferRequest*> failed;
+        {
+            std::lock_guard<std::mutex> lock(worker._mutex);
+            failed.swap(worker._runningRequests);
+        }
+        if (failed.empty()) {
+            failed = std::move(requests);
+        }
+        // the completion callback of the worker request was not called, so the worker request is idle again
+        if (!failed.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _idleWorkerRequests.push_back(&worker);
+            }
+            _timeoutCondVar.notify_one();
+        }
+        for (auto&& request : failed) {
+            request->_exception = std::current_exception();
+            request->OnCompletion(StatusCode::GENERAL_ERROR, false);
+        }
+    }
+}
+
+void AutoBatchExecutableNetwork::OnBatchCompletion(WorkerInferRequest& worker, StatusCode status) {
+    std::vector<AutoBatchInferRequest*> completed;
+    {
+        std::lock_guard<std::mutex> workerLock(worker._mutex);
+        completed.swap(worker._runningRequests);
+    }
+    // the results are copied from the slots before the worker request is given to the next batch
+    for (auto&& request : completed) {
+        request->OnCompletion(status, true);
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idleWorkerRequests.push_back(&worker);
+    StartBatches(lock);
+    // the pending requests may have changed, so the timeout thread re-evaluates the nearest deadline
+    _timeoutCondVar.notify_one();
+}
+
+void AutoBatchExecutableNetwork::StartBatches(std::unique_lock<std::mutex>& lock) {
+    const auto batchSize = static_cast<std::size_t>(_device.batchForDevice);
+    while (!_pendingRequests.empty()) {
+        const bool fullBatch = _pendingRequests.size() >= batchSize;
+        const bool expired = _pendingRequests.front().second <= std::chrono::steady_clock::now();
+        if (!fullBatch && !expired) {
+            break;
+        }
+        if (!fullBatch && !_dynamicBatchSupported) {
+            // the whole batch would be computed for just a few samples, so the expired requests run alone
+            std::vector<AutoBatchInferRequest*> requests;
+            while (!_pendingRequests.empty() && _pendingRequests.front().second <= std::chrono::steady_clock::now()) {
+                requests.push_back(_pendingRequests.front().first);
+                _pendingRequests.pop_front();
+            }
+            // the requests may complete (and be re-scheduled) synchronously, so the lock is not held while starting them
+            lock.unlock();
+            for (auto&& request : requests) {
+                request->StartWithoutBatch();
+            }
+            lock.lock();
+            continue;
+        }
+        if (_idleWorkerRequests.empty()) {
+            // the batch is started once any of the running worker requests completes
+            break;
+        }
+        auto worker = _idleWorkerRequests.front();
+        _idleWorkerRequests.pop_front();
+        // the requests take the slots of the worker request in the order of submission
+        std::vector<AutoBatchInferRequest*> requests;
+        while (!_pendingRequests.empty() && requests.size() < batchSize) {
+            requests.push_back(_pendingRequests.front().first);
+            _pendingRequests.pop_front();
+        }
+        lock.unlock();
+        StartBatch(*worker, std::move(requests));
+        lock.lock();
+    }
+}
+
+void AutoBatchExecutableNetwork::ScheduleToWorkerInferRequest(AutoBatchInferRequest* request) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _pendingRequests.emplace_back(request, std::chrono::steady_clock::now() + _timeout);
+    if (_pendingRequests.size() >= static_cast<std::size_t>(_device.batchForDevice)) {
+        StartBatches(lock);
+    } else if (_pendingRequests.size() == 1) {
+        // the timeout thread waits without a deadline while there is no pending request
+        _timeoutCondVar.notify_one();
+    }
+}
+
+void AutoBatchExecutableNetwork::TimeoutLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_terminate) {
+        StartBatches(lock);
+        if (_terminate) {
+            break;
+        }
+        if (_pendingRequests.empty() || _pendingRequests.front().second <= std::chrono::steady_clock::now()) {
+            // either nothing to wait for or the expired requests wait for an idle worker request
+            _timeoutCondVar.wait(lock);
+        } else {
+            _timeoutCondVar.wait_until(lock, _pendingRequests.front().second);
+        }
+    }
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    // every batch of the user requests has its worker request, while the slots are taken on submission
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_numRequestsCreated++ % _device.batchForDevice == 0) {
+        _workerRequests.emplace_back(new WorkerInferRequest{});
+        auto worker = _workerRequests.back().get();
+        worker->_inferRequest = _networkWithBatch.CreateInferRequest();
+        worker->_slotInputs.resize(_device.batchForDevice);
+        worker->_slotOutputs.resize(_device.batchForDevice);
+        for (int batchId = 0; batchId < _device.batchForDevice; ++batchId) {
+            for (const auto& input : networkInputs) {
+                worker->_slotInputs[batchId][input.first] =
+                    CreateSlotBlob(worker->_inferRequest.GetBlob(input.first), batchId, _device.batchForDevice);
+            }
+            for (const auto& output : networkOutputs) {
+                worker->_slotOutputs[batchId][output.first] =
+                    CreateSlotBlob(worker->_inferRequest.GetBlob(output.first), batchId, _device.batchForDevice);
+            }
+        }
+        worker->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [this, worker] (InferRequest , StatusCode status) mutable {
+                OnBatchCompletion(*worker, status);
+            });
+        _idleWorkerRequests.push_back(worker);
+    }
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, _networkWithoutBatch.CreateInferRequest());
+}
+
+IInferRequest::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The BATCH device does not support changing the configuration "
+                       << "of the loaded network";
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        // find config key among networks config keys
+        auto param = _networkWithoutBatch.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        for (auto &&configKey : param.as<std::vector<std::string>>()) {
+            if (configKey == name) {
+                return _networkWithoutBatch.GetConfig(configKey);
+            }
+        }
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _networkWithBatch.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const details::InferenceEngineException &iie) {
+            THROW_IE_EXCEPTION
+                << "Every device used with the BATCH should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every worker request needs the full batch of the user requests to run without the timeout
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * _device.batchForDevice);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch.GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+}  // namespace AutoBatchPlugin
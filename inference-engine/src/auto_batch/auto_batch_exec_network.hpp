@@ -0,0 +1,87 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+
+namespace AutoBatchPlugin {
+
+struct DeviceInformation {
+    std::string                         deviceName;
+    std::map<std::string, std::string>  config;
+    int                                 batchForDevice;
+};
+
+class AutoBatchInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest           _inferRequest;
+        // the views of every sample of the batched blobs
+        std::vector<InferenceEngine::BlobMap>   _slotInputs;
+        std::vector<InferenceEngine::BlobMap>   _slotOutputs;
+        std::vector<AutoBatchInferRequest*>     _runningRequests;
+        std::mutex                              _mutex;
+    };
+    using PendingRequest = std::pair<AutoBatchInferRequest*, std::chrono::steady_clock::time_point>;
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                           networkWithBatch,
+                                        const InferenceEngine::ExecutableNetwork&                           networkWithoutBatch,
+                                        const DeviceInformation&                                            networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const bool                                                          dynamicBatchSupported);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork() override;
+
+    // collects the request into the next batch, the batch is started once it is full and a worker request is idle
+    void ScheduleToWorkerInferRequest(AutoBatchInferRequest* request);
+
+protected:
+    void TimeoutLoop();
+    // starts the full batches and the batches with the expired requests, the lock is released while starting them
+    void StartBatches(std::unique_lock<std::mutex>& lock);
+    void StartBatch(WorkerInferRequest& worker, std::vector<AutoBatchInferRequest*> requests);
+    void OnBatchCompletion(WorkerInferRequest& worker, InferenceEngine::StatusCode status);
+
+    InferenceEngine::ExecutableNetwork                          _networkWithBatch;
+    InferenceEngine::ExecutableNetwork                          _networkWithoutBatch;
+    DeviceInformation                                           _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _dynamicBatchSupported = false;
+    std::chrono::milliseconds                                   _timeout;
+    std::size_t                                                 _numRequestsCreated = 0;
+    std::vector<std::unique_ptr<WorkerInferRequest>>            _workerRequests;
+    // the rest of the members are guarded by the _mutex
+    std::mutex                                                  _mutex;
+    std::deque<WorkerInferRequest*>                             _idleWorkerRequests;
+    std::deque<PendingRequest>                                  _pendingRequests;
+    std::condition_variable                                     _timeoutCondVar;
+    bool                                                        _terminate = false;
+    std::thread                                                 _timeoutThread;
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,108 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <blob_factory.hpp>
+#include "auto_batch_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+void CopyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    if (src->byteSize() != dst->byteSize()) {
+        THROW_IE_EXCEPTION << "The blob of " << src->byteSize() << " bytes cannot be copied to the blob of "
+                           << dst->byteSize() << " bytes";
+    }
+    std::memcpy(dst->buffer().as<uint8_t*>(), src->cbuffer().as<const uint8_t*>(), src->byteSize());
+}
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&                               networkInputs,
+                                             const OutputsDataMap&                              networkOutputs,
+                                             InferRequest                                       requestWithoutBatch)
+        : InferRequestInternal(networkInputs, networkOutputs),
+          _requestWithoutBatch{requestWithoutBatch} {
+    // the request may take any slot of any worker request, so it owns its blobs and the data is copied to the slot
+    for (const auto &it : _networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _inputs[it.first]->allocate();
+    }
+    for (const auto &it : _networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _outputs[it.first]->allocate();
+    }
+    _requestWithoutBatch.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [this] (InferRequest , StatusCode status) mutable {
+            OnCompletion(status, false);
+        });
+}
+
+void AutoBatchInferRequest::BindToSlot(AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest, const int batchId) {
+    _workerRequest = &workerRequest;
+    _batchId = batchId;
+    _wasBatched = true;
+}
+
+void AutoBatchInferRequest::CopyInputsToSlot() {
+    // this request is already in BUSY state, so using the internal members safely
+    execDataPreprocessing(_inputs);
+    for (const auto &it : _networkInputs) {
+        CopyBlob(_inputs[it.first], _workerRequest->_slotInputs[_batchId].at(it.first));
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromSlot() {
+    for (const auto &it : _networkOutputs) {
+        CopyBlob(_workerRequest->_slotOutputs[_batchId].at(it.first), _outputs[it.first]);
+    }
+}
+
+void AutoBatchInferRequest::StartWithoutBatch() {
+    try {
+        _wasBatched = false;
+        execDataPreprocessing(_inputs);
+        for (const auto &it : _networkInputs) {
+            auto& blob = _inputs[it.first];
+            if (_requestWithoutBatch.GetBlob(it.first) != blob)
+                _requestWithoutBatch.SetBlob(it.first, blob);
+        }
+        for (const auto &it : _networkOutputs) {
+            auto& blob = _outputs[it.first];
+            if (_requestWithoutBatch.GetBlob(it.first) != blob)
+                _requestWithoutBatch.SetBlob(it.first, blob);
+        }
+        _requestWithoutBatch.StartAsync();
+    } catch (...) {
+        _exception = std::current_exception();
+        OnCompletion(StatusCode::GENERAL_ERROR, false);
+    }
+}
+
+void AutoBatchInferRequest::OnCompletion(StatusCode status, const bool batched) {
+    _status = status;
+    if (batched && StatusCode::OK == status) {
+        try {
+            CopyOutputsFromSlot();
+        } catch (...) {
+            _exception = std::current_exception();
+            _status = StatusCode::GENERAL_ERROR;
+        }
+    }
+    auto capturedTask = std::move(_task);
+    capturedTask();
+}
+
+void AutoBatchInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+    perfMap = _wasBatched ? _workerRequest->_inferRequest.GetPerformanceCounts()
+                          : _requestWithoutBatch.GetPerformanceCounts();
+}
+
+}  // namespace AutoBatchPlugin
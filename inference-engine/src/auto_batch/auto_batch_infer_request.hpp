@@ -0,0 +1,51 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include "auto_batch_exec_network.hpp"
+
+namespace AutoBatchPlugin {
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&                    networkInputs,
+                                   const InferenceEngine::OutputsDataMap&                   networkOutputs,
+                                   InferenceEngine::InferRequest                            requestWithoutBatch);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const override;
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    // Auto-Batching impl specific: makes the request use the batchId-th sample of the worker request
+    void BindToSlot(AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest, const int batchId);
+    // Auto-Batching impl specific: copies the data of the user blobs to the slot of the batched request
+    void CopyInputsToSlot();
+    // Auto-Batching impl specific: copies the results from the slot of the batched request to the user blobs
+    void CopyOutputsFromSlot();
+    // Auto-Batching impl specific: executes the request alone, when the batch is not collected in time
+    void StartWithoutBatch();
+    void OnCompletion(InferenceEngine::StatusCode status, const bool batched);
+
+    InferenceEngine::InferRequest                       _requestWithoutBatch;
+    InferenceEngine::Task                               _task;
+    InferenceEngine::StatusCode                         _status = InferenceEngine::StatusCode::OK;
+    std::exception_ptr                                  _exception = nullptr;
+
+protected:
+    // the slot the request took on the last submission
+    AutoBatchExecutableNetwork::WorkerInferRequest*     _workerRequest = nullptr;
+    int                                                 _batchId = -1;
+    bool                                                _wasBatched = false;
+};
+
+}  // namespace AutoBatchPlugin
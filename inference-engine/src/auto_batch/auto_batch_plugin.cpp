@@ -0,0 +1,254 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <tuple>
+#include <utility>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include <ngraph/graph_util.hpp>
+#include "auto_batch_plugin.hpp"
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    // a batch is collected within a few milliseconds, so a single request does not wait much longer than it executes
+    const char defaultTimeout[] = "5";
+
+    void checkTimeout(const std::string& timeout) {
+        try {
+            if (std::stoi(timeout) < 0)
+                throw std::out_of_range{timeout};
+        } catch (...) {
+            THROW_IE_EXCEPTION << "Incorrect value for KEY_AUTO_BATCH_TIMEOUT: " << timeout;
+        }
+    }
+
+    // the device is specified as "CPU(16)", where 16 is the batch the requests are collected into
+    std::pair<std::string, int> parseDeviceWithBatch(const std::string& deviceWithBatch) {
+        auto openingBracket = deviceWithBatch.find_first_of('(');
+        auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+        if (openingBracket == std::string::npos || closingBracket != deviceWithBatch.length() - 1) {
+            THROW_IE_EXCEPTION << "Expected the batch size in brackets after the device name, e.g. \"CPU(16)\", got: "
+                               << deviceWithBatch;
+        }
+        auto deviceName = deviceWithBatch.substr(0, openingBracket);
+        auto batchStr = deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1);
+        int batch = 0;
+        try {
+            batch = std::stoi(batchStr);
+        } catch (...) {
+            THROW_IE_EXCEPTION << "Cannot parse the batch size for the " << deviceName << " device: " << batchStr;
+        }
+        if (deviceName.empty() || batch <= 0) {
+            THROW_IE_EXCEPTION << "Incorrect device or batch size for the BATCH device: " << deviceWithBatch;
+        }
+        return {deviceName, batch};
+    }
+}  // namespace
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseBatchDevice(const std::string& deviceWithBatch,
+                                                             const std::map<std::string, std::string> & config) const {
+    std::string deviceName;
+    int batch = 0;
+    std::tie(deviceName, batch) = parseDeviceWithBatch(deviceWithBatch);
+
+    // use only the settings that are applicable to the device
+    auto deviceConfig = GetSupportedConfig(config, deviceName);
+    return { deviceName, deviceConfig, batch };
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, Parameter> & options) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for KEY_AUTO_BATCH_DEVICE_CONFIG is not set";
+        } else {
+            return { it->second };
+        }
+    } else if (name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        auto it = _config.find(name);
+        return { it == _config.end() ? std::string{defaultTimeout} : it->second };
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        if (kvp.first == AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG)) {
+            parseDeviceWithBatch(kvp.second);
+        } else if (kvp.first == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+            checkTimeout(kvp.second);
+        }
+    }
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        THROW_IE_EXCEPTION << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto device = ParseBatchDevice(deviceConfig->second, fullConfig);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*deviceConfig);
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (timeout != fullConfig.end()) {
+        checkTimeout(timeout->second);
+        networkConfig.insert(*timeout);
+    } else {
+        networkConfig.insert({AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, std::string{defaultTimeout}});
+    }
+
+    // the batch is collected along the outermost dimension, so every input should be a single-sample one
+    const auto inputs = network.getInputsInfo();
+    ICNNNetwork::InputShapes shapes = network.getInputShapes();
+    for (auto&& input : inputs) {
+        auto layout = input.second->getLayout();
+        auto& dims = shapes[input.first];
+        const bool batchFirstLayout = layout == Layout::NC || layout == Layout::NCHW || layout == Layout::NHWC ||
+                                      layout == Layout::NCDHW || layout == Layout::NDHWC;
+        if (!batchFirstLayout || dims.empty() || dims[0] != 1) {
+            THROW_IE_EXCEPTION << "BATCH device requires the inputs with the batch of 1 in the outermost dimension, "
+                               << "the input " << input.first << " does not meet that";
+        }
+        dims[0] = device.batchForDevice;
+    }
+
+    // the network without batch serves the requests that were not collected into the full batch in time
+    auto networkWithoutBatch = GetCore()->LoadNetwork(network, device.deviceName, device.config);
+
+    CNNNetwork clonedNetwork(ngraph::clone_function(*network.getFunction()));
+    for (auto&& input : clonedNetwork.getInputsInfo()) {
+        auto& original = inputs.at(input.first);
+        input.second->setPrecision(original->getPrecision());
+        input.second->setLayout(original->getLayout());
+        input.second->getPreProcess() = original->getPreProcess();
+    }
+    const auto outputs = network.getOutputsInfo();
+    for (auto&& output : clonedNetwork.getOutputsInfo()) {
+        auto original = outputs.find(output.first);
+        if (original != outputs.end()) {
+            output.second->setPrecision(original->second->getPrecision());
+        }
+    }
+    clonedNetwork.reshape(shapes);
+
+    // with the dynamic batch a partially collected batch still executes as a single request
+    bool dynamicBatchSupported = false;
+    std::vector<std::string> supportedConfigKeys =
+        GetCore()->GetMetric(device.deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    if (std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(), CONFIG_KEY(DYN_BATCH_ENABLED))
+        != supportedConfigKeys.end()) {
+        auto dynamicBatchConfig = device.config;
+        dynamicBatchConfig[CONFIG_KEY(DYN_BATCH_ENABLED)] = CONFIG_VALUE(YES);
+        try {
+            auto networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, device.deviceName, dynamicBatchConfig);
+            dynamicBatchSupported = true;
+            networkConfig.insert(device.config.begin(), device.config.end());
+            return std::make_shared<AutoBatchExecutableNetwork>(networkWithBatch, networkWithoutBatch,
+                                                                device, networkConfig, dynamicBatchSupported);
+        } catch (const InferenceEngine::details::InferenceEngineException&) {
+            // the network is not compatible with the dynamic batch, so loading it with the regular one
+        }
+    }
+    auto networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, device.deviceName, device.config);
+    networkConfig.insert(device.config.begin(), device.config.end());
+    return std::make_shared<AutoBatchExecutableNetwork>(networkWithBatch, networkWithoutBatch,
+                                                        device, networkConfig, dynamicBatchSupported);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto device = ParseBatchDevice(deviceConfig->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, device.deviceName, device.config);
+    for (auto&& layerQr : queryResult.supportedLayersMap) {
+        layerQr.second = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
@@ -98,14 +98,10 @@ class ModelQuantizer {
     void propagateScaleFactor(std::vector<InferenceEngine::CNNLayerPtr> & net, int weightsBytesSize) const {
         ScaleFactorCalculator sf(net, weightsBytesSize);
 
+        // layers are transformed in sorted order, when output scale is updated due to situation in downstream layer
+        // calculator moves back to the restarted layer
         while (!sf.allLayersProcessed()) {
-            for (auto &&layer : sf.getStartLayers()) {
-                transformLayer(layer, sf);
-                // transforming until we reached cases where output scale updated due to situation in downstream layer
-                if (sf.needToRestart()) {
-                    break;
-                }
-            }
+            transformLayer(sf.getCurrentLayer(), sf);
         }
     }
 };
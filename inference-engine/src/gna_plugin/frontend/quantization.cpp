@@ -2,14 +2,22 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <details/ie_exception.hpp>
 #include <gna_plugin_log.hpp>
 #include <limits>
+#include <vector>
+#include <ie_parallel.hpp>
 #include "backend/gna_types.h"
 #include "quantization.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GNA_QUANTIZATION_SSE2
+#include <emmintrin.h>
+#endif
+
 #ifdef DEBUG
 #define QUANTWARNING(...) (fprintf(stderr, __VA_ARGS__))
 #else
@@ -94,27 +102,7 @@ void QuantizationCallback<int16_t, int32_t>::runQuantize() const {
 
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i * num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsValue(ptr_float_weights, static_cast<size_t>(num_rows) * num_columns);
 
         if (max_weight != 0.0f) {
             *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_2B_WEIGHT) / max_weight;
@@ -176,16 +164,53 @@ void QuantizationCallback<int16_t, int32_t>::runQuantize() const {
     }
 }
 
-float ScaleFactorForQuantization(void *ptr_float_memory, float target_max, size_t num_elements) {
-    float *ptr_float_feat = reinterpret_cast<float *>(ptr_float_memory);
-    float max = 0.0;
-    float scale_factor;
-
-    for (size_t i = 0; i < num_elements; i++) {
-        if (fabs(ptr_float_feat[i]) > max) {
-            max = fabs(ptr_float_feat[i]);
+namespace {
+
+float MaxAbsValueSequential(const float *ptr, size_t num_elements) {
+    float max = 0.0f;
+    size_t i = 0;
+#ifdef GNA_QUANTIZATION_SSE2
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= num_elements; i += 4) {
+        // accumulator is the second operand, so NaNs are skipped as by the scalar comparison below
+        acc = _mm_max_ps(_mm_andnot_ps(sign, _mm_loadu_ps(ptr + i)), acc);
+    }
+    acc = _mm_max_ps(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_max_ps(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    max = _mm_cvtss_f32(acc);
+#endif
+    for (; i < num_elements; i++) {
+        if (fabs(ptr[i]) > max) {
+            max = fabs(ptr[i]);
         }
     }
+    return max;
+}
+
+}  // namespace
+
+float MaxAbsValue(const float *ptr_float_memory, size_t num_elements) {
+    if (num_elements < kMaxAbsValueParallelChunk * 2) {
+        return MaxAbsValueSequential(ptr_float_memory, num_elements);
+    }
+    const size_t num_chunks = (num_elements + kMaxAbsValueParallelChunk - 1) / kMaxAbsValueParallelChunk;
+    std::vector<float> chunk_max(num_chunks);
+    InferenceEngine::parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t offset = chunk * kMaxAbsValueParallelChunk;
+        chunk_max[chunk] = MaxAbsValueSequential(ptr_float_memory + offset,
+                                                 std::min(kMaxAbsValueParallelChunk, num_elements - offset));
+    });
+    float max = 0.0f;
+    for (auto value : chunk_max) {
+        max = std::max(max, value);
+    }
+    return max;
+}
+
+float ScaleFactorForQuantization(void *ptr_float_memory, float target_max, size_t num_elements) {
+    float max = MaxAbsValue(reinterpret_cast<const float *>(ptr_float_memory), num_elements);
+    float scale_factor;
 
     if (max == 0) {
         scale_factor = -1.0f;  // need to handle all zeros as a special case
@@ -311,27 +336,7 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
 
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i*num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsValue(ptr_float_weights, static_cast<size_t>(num_rows) * num_columns);
 
         *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_1B_WEIGHT) / max_weight;
 
@@ -343,17 +348,11 @@ void QuantizationCallback<int8_t, gna_compound_bias_t>::runQuantize() const {
         *ptr_weight_scale_factor = MAX_OUT_MULTIPLIER * *ptr_weight_scale_factor;  //  increase dynamic range by max multiplier
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
-    float valueAcc = 0.0;
     for (uint32_t row = 0; row < num_rows; row++) {
-        float scaled_row_max = 0;
+        // scaling by a positive factor keeps the order of magnitudes, so the row maximum is scaled once
+        float row_max = MaxAbsValue(ptr_float_weights + row * num_columns, num_columns);
+        float scaled_row_max = row_max > 0 ? row_max * *ptr_weight_scale_factor : 0.0f;
         float rounding_value, value;
-        for (uint32_t col = 0; col < num_columns; col++) {
-            value = ptr_float_weights[row*num_columns + col] * *ptr_weight_scale_factor;
-            valueAcc += value;
-            if (fabs(value) > scaled_row_max) {
-                scaled_row_max = fabs(value);
-            }
-        }
 
         value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
         ptr_int_biases[row].multiplier = (uint8_t) (value + 0.5);
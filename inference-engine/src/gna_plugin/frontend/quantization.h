@@ -45,5 +45,12 @@ struct QuantizationCallback {
 template class QuantizationCallback<int16_t, int32_t>;
 template class QuantizationCallback<int8_t, gna_compound_bias_t>;
 
+/**
+ * @brief Maximum of absolute values of the buffer, NaNs are skipped and 0 is returned for an empty buffer.
+ * Uses SSE2 where available and splits big buffers between threads
+ */
+float MaxAbsValue(const float *ptr_float_memory, size_t num_elements);
+constexpr size_t kMaxAbsValueParallelChunk = 1 << 16;
+
 float ScaleFactorForQuantization(void *ptr_float_memory, float target_max, size_t num_elements);
 void QuantizeVector16(float *ptr_float_memory, int16_t *ptr_int_memory, uint32_t num_elements, float scale_factor);
@@ -10,12 +10,14 @@
 #include <limits>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include <legacy/ie_layers.h>
 #include "gna_upstream_iterator.hpp"
 #include "layers/gna_layer_info.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
+#include "quantization.h"
 
 namespace GNAPluginNS {
 namespace frontend {
@@ -257,19 +259,12 @@ class ScaleFactorPerLayer<InferenceEngine::CNNLayer *> {
                 blob = make_fp32_blob(blob);
             }
 
-            auto max_val = std::numeric_limits<float>::min();
-            auto min_val = std::numeric_limits<float>::max();
-
             auto flt_buf = blob->buffer().as<float*>();
             auto size = blob->size();
 
-            for (int i=0; i < size; i++) {
-                auto val = flt_buf[i];
-                if (val > max_val) max_val = val;
-                if (val < min_val) min_val = val;
-            }
-
-            auto abs_val = std::max(std::abs(max_val), std::abs(min_val));
+            // same bounds as tracking min and max starting from FLT_MIN and FLT_MAX
+            auto abs_val = size == 0 ? std::numeric_limits<float>::max()
+                                     : std::max(std::numeric_limits<float>::min(), MaxAbsValue(flt_buf, size));
             auto scale_val = static_cast<float>(std::numeric_limits<int16_t>::max()) / abs_val;
 
             // TODO: Investigate what should be the scale in such cases (31910)
@@ -700,24 +695,32 @@ class ScaleFactorPerLayer<InferenceEngine::ConvolutionLayer*> : public ScaleFact
  */
 class ScaleFactorCalculator {
     using Cnt = std::vector<InferenceEngine::CNNLayerPtr>;
-    Cnt  net;
-    mutable Cnt::const_iterator idx;
+    const Cnt &net;
+    // restarts jump back to an arbitrary layer, position lookup keeps them cheap on big networks
+    std::unordered_map<InferenceEngine::CNNLayer *, size_t> positions;
+    mutable size_t idx = 0;
     mutable bool needRestart = false;
     int weightsBytesSize;
 
  public:
-    ScaleFactorCalculator(Cnt &net, int weightsBytesSize)
+    ScaleFactorCalculator(const Cnt &net, int weightsBytesSize)
             : net(net), weightsBytesSize(weightsBytesSize) {
-        idx = std::begin(this->net);
+        positions.reserve(net.size());
+        for (size_t i = 0; i < net.size(); i++) {
+            positions.emplace(net[i].get(), i);
+        }
     }
     bool needToRestart() const {
         return needRestart;
     }
     bool allLayersProcessed() const {
-        return idx == std::end(net);
+        return idx == net.size();
     }
-    std::vector<InferenceEngine::CNNLayerPtr> getStartLayers() const {
-        return std::vector<InferenceEngine::CNNLayerPtr>(idx, std::end(net));
+    /**
+     * @brief layer to be processed next, valid while not all layers are processed
+     */
+    const InferenceEngine::CNNLayerPtr &getCurrentLayer() const {
+        return net[idx];
     }
     template<class T>
     bool operator()(T ptr) const {
@@ -731,15 +734,8 @@ class ScaleFactorCalculator {
             return true;
         }
 
-        idx = std::find_if(net.begin(), net.end(), [&](InferenceEngine::CNNLayerPtr cnnLayer) {
-            if (!result) {
-                return result.restartLayer == cnnLayer.get();
-            }
-            return ptr == cnnLayer.get();
-        });
-        if (idx != net.end()) {
-            idx++;
-        }
+        auto restartPosition = positions.find(result.restartLayer);
+        idx = restartPosition == positions.end() ? net.size() : restartPosition->second + 1;
         needRestart = true;
         return true;
     }
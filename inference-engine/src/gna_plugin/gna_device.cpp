@@ -86,6 +86,7 @@ uint32_t GNADeviceHelper::propagate(const uint32_t requestConfigId, Gna2Accelera
     const auto status2 = Gna2RequestEnqueue(requestConfigId, &reqId);
     checkGna2Status(status2, "Gna2RequestEnqueue");
 
+    std::unique_lock<std::mutex> lockRequestIds{ unwaitedRequestIdsSync };
     unwaitedRequestIds.insert(reqId);
 
     return reqId;
@@ -332,7 +333,10 @@ GnaWaitStatus GNADeviceHelper::wait(uint32_t reqId, int64_t millisTimeout) {
     if (status == Gna2StatusWarningDeviceBusy) {
         return GNA_REQUEST_PENDING;
     }
-    unwaitedRequestIds.erase(reqId);
+    {
+        std::unique_lock<std::mutex> lockRequestIds{ unwaitedRequestIdsSync };
+        unwaitedRequestIds.erase(reqId);
+    }
     if (status == Gna2StatusDriverQoSTimeoutExceeded) {
         return GNA_REQUEST_ABORTED;
     }
@@ -463,6 +467,14 @@ void GNADeviceHelper::setOMPThreads(uint8_t const n_threads) {
 #endif
 }
 
+#if GNA_LIB_VER == 2
+void GNADeviceHelper::setNumberOfWorkerThreads(uint8_t const n_threads) {
+    std::unique_lock<std::mutex> lockGnaCalls{ acrossPluginsSync };
+    const auto status = Gna2DeviceSetNumberOfThreads(nGnaDeviceIndex, n_threads);
+    checkGna2Status(status, "Gna2DeviceSetNumberOfThreads");
+}
+#endif
+
 void GNADeviceHelper::updateGnaPerfCounters() {
     if (!isPerformanceMeasuring)
         return;
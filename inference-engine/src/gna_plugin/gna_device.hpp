@@ -63,6 +63,7 @@ class GNADeviceHelper {
     uint64_t instrumentationTotal[TotalGna2InstrumentationPoints] = {};
     uint32_t instrumentationConfigId = 0;
     std::set<uint32_t> unwaitedRequestIds;
+    std::mutex unwaitedRequestIdsSync;
 #define MAX_TIMEOUT 500000
 #endif
     bool isPerformanceMeasuring = false;
@@ -130,6 +131,17 @@ public:
     bool isUpTo20GnaDevice() const {
         return detectedGnaDevVersion <= Gna2DeviceVersion2_0;
     }
+    /**
+     * @brief whether requests in given acceleration mode are executed by the library on CPU
+     */
+    bool isSoftwareEmulation(Gna2AccelerationMode gna2AccelerationMode) const {
+        return gna2AccelerationMode != Gna2AccelerationModeHardware &&
+            (gna2AccelerationMode != Gna2AccelerationModeAuto || !hasGnaHw());
+    }
+    /**
+     * @brief sets number of library worker threads, so that many enqueued requests are emulated concurrently
+     */
+    void setNumberOfWorkerThreads(uint8_t n_threads);
     static void checkGna2Status(Gna2Status status, const std::string& from);
     static void checkGna2Status(Gna2Status status, const Gna2Model& gnaModel);
 #endif
@@ -4,6 +4,7 @@
 
 #define NOMINMAX
 
+#include <chrono>
 #include <vector>
 #include <cstring>
 #include <list>
@@ -26,6 +27,7 @@
 #include "caseless.hpp"
 #include "backend/am_intel_dnn.hpp"
 #include "runtime/pwl.h"
+#include "runtime/pwl_design_cache.hpp"
 #include "gna_graph_tools.hpp"
 #include "frontend/model_quantizer.hpp"
 #include "layers/layers_builder.hpp"
@@ -582,10 +584,7 @@ void GNAGraphCompiler::PowerPrimitive(InferenceEngine::CNNLayerPtr layer) {
 
         auto orientation = kDnnInterleavedOrientation;
 
-        auto activation_type = DnnActivation::fromType(kActPow);
-        activation_type.args.pow.exponent = power.power;
-        activation_type.args.pow.scale = power.scale;
-        activation_type.args.pow.offset = power.offset;
+        auto activation_type = GetPowerActivation(power);
 
         auto& pwlComponent = dnnComponents.addComponent(layer->name, "power");
 
@@ -608,7 +607,7 @@ void GNAGraphCompiler::PowerPrimitive(InferenceEngine::CNNLayerPtr layer) {
                     input_pwl_scale_factor,
                     output_pwl_scale_factor);
             } else {
-                PwlDesignOpt16(activation_type,
+                runtime::PwlDesignCache::instance().design(activation_type,
                     ptr_pwl_segments,
                     input_pwl_scale_factor,
                     output_pwl_scale_factor);
@@ -1505,14 +1504,17 @@ void GNAGraphCompiler::FakeQuantizePrimitive(InferenceEngine::CNNLayerPtr layer)
     }
 }
 
-void GNAGraphCompiler::PWLPrimitive(InferenceEngine::CNNLayerPtr layer) {
+DnnActivation GNAGraphCompiler::GetPowerActivation(const InferenceEngine::PowerLayer& power) {
+    auto activation_type = DnnActivation::fromType(kActPow);
+    activation_type.args.pow.exponent = power.power;
+    activation_type.args.pow.scale = power.scale;
+    activation_type.args.pow.offset = power.offset;
+    return activation_type;
+}
+
+bool GNAGraphCompiler::GetPwlActivation(InferenceEngine::CNNLayerPtr layer, DnnActivation& activation_type) {
     auto* generic = dynamic_cast<GenericLayer*>(layer.get());
     std::string type;
-    std::vector<gna_pwl_segment_t> ptr_pwl_segments;
-    uint32_t num_rows;
-    uint32_t num_columns;
-    void* ptr_inputs = nullptr;
-    void* ptr_outputs = nullptr;
 
     do {
         if (generic == nullptr) {
@@ -1529,6 +1531,82 @@ void GNAGraphCompiler::PWLPrimitive(InferenceEngine::CNNLayerPtr layer) {
         }
     } while (false);
 
+    static InferenceEngine::details::caseless_unordered_map<std::string, DnnActivationType> supportedActivations = {
+        {"sigmoid", kActSigmoid},
+        {"tanh", kActTanh},
+        {"relu", kActRelu},
+        {"leakyrelu", kActLeakyRelu},
+        {"clamp", kActKaldiLstmClipping},
+        {"exp", kActExp},
+        {"log", kActLog},
+        {"sign", kActSign},
+        {"abs", kActAbs},
+        {"neglog", kActNegLog},
+        {"neghalflog", kActNegHalfLog},
+        {"identity", kActIdentity},
+        {"softsign", kActSoftSign},
+        {"fakequantize", kActFakeQuantize}
+    };
+
+    auto it = supportedActivations.find(type);
+    if (it == supportedActivations.end()) {
+        return false;
+    }
+    activation_type = DnnActivation::fromType(it->second);
+    if (it->second == kActRelu) {
+        auto reluLayer = dynamic_cast<ReLULayer*>(layer.get());
+        activation_type.args.lrelu.negative_slope = reluLayer != nullptr ? reluLayer->negative_slope : 0.0f;
+    } else {
+        activation_type.args.lrelu.negative_slope = 0.0f;
+    }
+
+    if (it->second == kActFakeQuantize) {
+        activation_type = GNAFakeQuantizeLayer(layer).parseAsActivation();
+    }
+    return true;
+}
+
+void GNAGraphCompiler::PrecomputePwlDesigns(const std::vector<InferenceEngine::CNNLayerPtr>& layers) {
+    if (gnaFlags->sw_fp32 || gnaFlags->uniformPwlDesign) {
+        return;
+    }
+    std::vector<runtime::PwlDesignCache::Request> requests;
+    for (auto&& layer : layers) {
+        auto quantized = InferenceEngine::getInjectedData<QuantizedLayerParams>(layer);
+        if (quantized == nullptr) {
+            continue;
+        }
+        DnnActivation activation_type;
+        if (LayerInfo(layer).isPower()) {
+            auto power = dynamic_cast<PowerLayer*>(layer.get());
+            if (power == nullptr || power->power == 1.0f) {
+                continue;
+            }
+            activation_type = GetPowerActivation(*power);
+        } else if (LayerInfo(layer).isFakeQuantize() || !GetPwlActivation(layer, activation_type)) {
+            continue;
+        }
+        requests.push_back({activation_type, quantized->_src_quant.GetScale(), quantized->_dst_quant.GetScale()});
+    }
+    if (requests.empty()) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto statistics = runtime::PwlDesignCache::instance().precompute(requests);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    gnalog() << "PWL design: " << statistics.requested << " activation layers, " << statistics.designed
+             << " new designs, " << statistics.requested - statistics.designed << " reused, "
+             << elapsed.count() << " ms\n";
+}
+
+void GNAGraphCompiler::PWLPrimitive(InferenceEngine::CNNLayerPtr layer) {
+    std::vector<gna_pwl_segment_t> ptr_pwl_segments;
+    uint32_t num_rows;
+    uint32_t num_columns;
+    void* ptr_inputs = nullptr;
+    void* ptr_outputs = nullptr;
+
     GNA_LAYER_ASSERT(layer, !layer->insData.empty());
     GNA_LAYER_ASSERT(layer, !layer->outData.empty());
 
@@ -1575,37 +1653,9 @@ void GNAGraphCompiler::PWLPrimitive(InferenceEngine::CNNLayerPtr layer) {
     size_t num_data_bytes_out = num_columns * num_rows * outputs->getPrecision().size();
     size_t num_data_bytes_in = num_columns * num_rows * inputs->getPrecision().size();
 
-    static InferenceEngine::details::caseless_unordered_map<std::string, DnnActivationType> supportedActivations = {
-        {"sigmoid", kActSigmoid},
-        {"tanh", kActTanh},
-        {"relu", kActRelu},
-        {"leakyrelu", kActLeakyRelu},
-        {"clamp", kActKaldiLstmClipping},
-        {"exp", kActExp},
-        {"log", kActLog},
-        {"sign", kActSign},
-        {"abs", kActAbs},
-        {"neglog", kActNegLog},
-        {"neghalflog", kActNegHalfLog},
-        {"identity", kActIdentity},
-        {"softsign", kActSoftSign},
-        {"fakequantize", kActFakeQuantize}
-    };
-
-    auto it = supportedActivations.find(type);
-    if (it == supportedActivations.end()) {
-        THROW_GNA_EXCEPTION << "Activation function type not yet supported: " << type;
-    }
-    auto activation_type = DnnActivation::fromType(it->second);
-    if (it->second == kActRelu) {
-        auto reluLayer = dynamic_cast<ReLULayer*>(layer.get());
-        activation_type.args.lrelu.negative_slope = reluLayer != nullptr ? reluLayer->negative_slope : 0.0f;
-    } else {
-        activation_type.args.lrelu.negative_slope = 0.0f;
-    }
-
-    if (it->second == kActFakeQuantize) {
-        activation_type = GNAFakeQuantizeLayer(layer).parseAsActivation();
+    DnnActivation activation_type;
+    if (!GetPwlActivation(layer, activation_type)) {
+        THROW_GNA_LAYER_EXCEPTION(layer) << "Activation function type not yet supported: " << layer->type;
     }
 
     string actName = "unknown";
@@ -1665,7 +1715,7 @@ case name:\
                 input_pwl_scale_factor,
                 output_pwl_scale_factor);
         } else {
-            PwlDesignOpt16(activation_type,
+            runtime::PwlDesignCache::instance().design(activation_type,
                 ptr_pwl_segments,
                 input_pwl_scale_factor,
                 output_pwl_scale_factor);
@@ -106,6 +106,20 @@ public:
 
     void CreateLayerPrimitive(InferenceEngine::CNNLayerPtr);
 
+    /**
+     * Designs PWL segments of all activation and power layers ahead of their primitives,
+     * repeated designs are computed once and distinct ones in parallel
+     * @param layers - layers that are going to be compiled
+     */
+    void PrecomputePwlDesigns(const std::vector<InferenceEngine::CNNLayerPtr>& layers);
+
+    /**
+     * Activation approximated by the PWL of an activation layer
+     * @return false if the layer is not a supported activation
+     */
+    static bool GetPwlActivation(InferenceEngine::CNNLayerPtr layer, DnnActivation& activation);
+    static DnnActivation GetPowerActivation(const InferenceEngine::PowerLayer& power);
+
     void AffinePrimitive(InferenceEngine::CNNLayerPtr, bool isDiag = false);
     void AffineFilterPrimitive(InferenceEngine::CNNLayerPtr);
     void ConcatAlignFilterPrimitive(InferenceEngine::CNNLayerPtr);
@@ -4,6 +4,7 @@
 
 #define NOMINMAX
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <vector>
@@ -87,6 +88,104 @@ namespace InferenceEngine {
 }
 #endif  // __clang__
 
+namespace {
+// input frames are quantized and transposed in tiles of vector elements, so the strided
+// stores to the interleaved buffer stay within a few cache lines
+constexpr uint32_t kInterleaveTileSize = 64;
+
+template <typename T, typename U>
+void convertFrame(T *dst, const U *src, uint32_t num_elements, float scaleFactor) {
+    for (uint32_t j = 0; j < num_elements; j++) {
+        dst[j] = GNAPluginNS::ConvertFloatToInt16(src[j] * scaleFactor);
+    }
+}
+
+template <typename T>
+void convertFrame(T *dst, const T *src, uint32_t num_elements, float) {
+    std::memcpy(dst, src, num_elements * sizeof(T));
+}
+
+inline void convertFrame(int16_t *dst, const float *src, uint32_t num_elements, float scaleFactor) {
+    GNAPluginNS::ConvertFloatToInt16(dst, src, num_elements, scaleFactor);
+}
+
+inline void convertFrame(uint16_t *dst, const float *src, uint32_t num_elements, float scaleFactor) {
+    GNAPluginNS::ConvertFloatToInt16(reinterpret_cast<int16_t *>(dst), src, num_elements, scaleFactor);
+}
+
+template <typename T, typename U>
+void exportInterleaved(T *dst,
+                       const U *src,
+                       uint32_t num_frames,
+                       uint32_t num_group,
+                       uint32_t num_vector_elements,
+                       uint32_t num_active_elements) {
+    // interleaved scores are read sequentially, each frame is written as a separate sequential stream
+    for (uint32_t j = 0; j < num_active_elements; j++) {
+        const U *src_vec = src + j * num_group;
+        for (uint32_t i = 0; i < num_frames; i++) {
+            dst[i * num_vector_elements + j] = static_cast<T>(src_vec[i]);
+        }
+    }
+    if (num_active_elements < num_vector_elements) {
+        for (uint32_t i = 0; i < num_frames; i++) {
+            std::fill(dst + i * num_vector_elements + num_active_elements, dst + (i + 1) * num_vector_elements, T(0));
+        }
+    }
+}
+
+template <typename T>
+void exportDeinterleaved(void *ptr_dst,
+                         const void *ptr_src,
+                         uint32_t num_frames,
+                         uint32_t num_vector_elements,
+                         uint32_t num_active_elements,
+                         uint32_t num_vector_stride) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        auto ptr_dst_vec = reinterpret_cast<T *>(ptr_dst) + i * num_vector_elements;
+        auto ptr_src_vec = reinterpret_cast<const T *>(ptr_src) + i * num_vector_stride;
+        ie_memcpy(ptr_dst_vec, num_active_elements * sizeof(T), ptr_src_vec, num_active_elements * sizeof(T));
+        std::fill(ptr_dst_vec + num_active_elements, ptr_dst_vec + num_vector_elements, T(0));
+    }
+}
+
+/**
+ * @brief marks request slot as busy until the request is enqueued, frees it if enqueuing did not happen
+ * @note constructed while slots lookup is locked already
+ */
+template <typename T>
+class RequestSlotReservation {
+    T *requestId;
+    std::mutex &requestSlotsSync;
+
+ public:
+    static constexpr T kReserved = -2;
+
+    RequestSlotReservation(T *requestId, std::mutex &requestSlotsSync)
+        : requestId(requestId), requestSlotsSync(requestSlotsSync) {
+        if (requestId != nullptr) {
+            *requestId = kReserved;
+        }
+    }
+    RequestSlotReservation(const RequestSlotReservation &) = delete;
+    RequestSlotReservation &operator=(const RequestSlotReservation &) = delete;
+    ~RequestSlotReservation() {
+        if (requestId != nullptr) {
+            std::lock_guard<std::mutex> lockRequestSlots{ requestSlotsSync };
+            *requestId = -1;
+        }
+    }
+
+    void commit(T enqueuedRequestId) {
+        if (requestId != nullptr) {
+            std::lock_guard<std::mutex> lockRequestSlots{ requestSlotsSync };
+            *requestId = enqueuedRequestId;
+            requestId = nullptr;
+        }
+    }
+};
+}  // namespace
+
 template <typename T, typename U>
 void GNAPlugin::copyInputData(T *dst,
                 const U *src,
@@ -100,43 +199,32 @@ void GNAPlugin::copyInputData(T *dst,
         return;
     }
     if (orientation == kDnnInterleavedOrientation) {
-        for (uint32_t i = 0; i < num_frames; i++) {
-            for (uint32_t j = 0; j < num_vector_elements; j++) {
-                if (!std::is_same<T, U>::value) {
-                    dst[j * num_group + i] = GNAPluginNS::ConvertFloatToInt16(src[i * num_vector_elements + j] * scaleFactor);
-                } else {
-                    dst[j * num_group + i] = src[i * num_vector_elements + j];
+        T tile[kInterleaveTileSize];
+        for (uint32_t j0 = 0; j0 < num_vector_elements; j0 += kInterleaveTileSize) {
+            const uint32_t tileSize = std::min(kInterleaveTileSize, num_vector_elements - j0);
+            for (uint32_t i = 0; i < num_frames; i++) {
+                convertFrame(tile, src + i * num_vector_elements + j0, tileSize, scaleFactor);
+                T *dst_vec = dst + j0 * num_group + i;
+                for (uint32_t j = 0; j < tileSize; j++) {
+                    dst_vec[j * num_group] = tile[j];
                 }
             }
-            // pad to meet weight matrix row length requirement
-            for (uint32_t j = num_vector_elements; j < num_vector_stride; j++) {
-                dst[j * num_group + i] = 0;
+            // pad partial group
+            for (uint32_t j = j0; j < j0 + tileSize; j++) {
+                std::fill(dst + j * num_group + num_frames, dst + (j + 1) * num_group, T(0));
             }
         }
-        // pad partial group
-        for (uint32_t i = num_frames; i < num_group; i++) {
-            for (uint32_t j = 0; j < num_vector_stride; j++) {
-                dst[j * num_group + i] = 0;
-            }
+        // pad to meet weight matrix row length requirement
+        if (num_vector_stride > num_vector_elements) {
+            std::memset(dst + num_vector_elements * num_group, 0,
+                        (num_vector_stride - num_vector_elements) * num_group * sizeof(T));
         }
     } else {
-        if (!std::is_same<T, U>::value) {
-            for (uint32_t i = 0; i < num_frames; i++) {
-                T *ptr_dst_vec = reinterpret_cast<T *>(dst) + i * num_vector_stride;
-                const U *ptr_src_vec = reinterpret_cast<const U *>(src) + i * num_vector_elements;
-                std::memset(ptr_dst_vec, 0, num_vector_stride * sizeof(T));
-                for (int j=0; j < num_vector_elements; j++) {
-                    ptr_dst_vec[j] = GNAPluginNS::ConvertFloatToInt16(ptr_src_vec[j] * scaleFactor);
-                }
-            }
-
-        } else {
-            for (uint32_t i = 0; i < num_frames; i++) {
-                void *ptr_dst_vec = reinterpret_cast<uint8_t *>(dst) + i * num_vector_stride * sizeof(T);
-                const void *ptr_src_vec = reinterpret_cast<const uint8_t *>(src) + i * num_vector_elements * sizeof(U);
-                std::memset(ptr_dst_vec, 0, num_vector_stride * sizeof(T));
-                ie_memcpy(ptr_dst_vec, num_vector_elements * sizeof(T),
-                    ptr_src_vec, num_vector_elements * sizeof(T));
+        for (uint32_t i = 0; i < num_frames; i++) {
+            T *ptr_dst_vec = dst + i * num_vector_stride;
+            convertFrame(ptr_dst_vec, src + i * num_vector_elements, num_vector_elements, scaleFactor);
+            if (num_vector_stride > num_vector_elements) {
+                std::memset(ptr_dst_vec + num_vector_elements, 0, (num_vector_stride - num_vector_elements) * sizeof(T));
             }
         }
 
@@ -167,13 +255,9 @@ void GNAPlugin::copyInputDataWithSplit(T *const dst,
             // output layer with bind pointer as previous one. Skip
             continue;
         }
-        for (uint32_t i = begin; i < end; ++i) {
-            if (!std::is_same<T, U>::value) {
-                *(dst_ptr++) = GNAPluginNS::ConvertFloatToInt16(*(src_ptr++) * inputsDesc->getScaleFactor(idx));
-            } else {
-                *(dst_ptr++) = *(src_ptr++);
-            }
-        }
+        convertFrame(dst_ptr, src_ptr, end - begin, inputsDesc->getScaleFactor(idx));
+        dst_ptr += end - begin;
+        src_ptr += end - begin;
         begin = end;
         end = (outputLayer.offset + ALIGN64(outputLayer.pure_size))/precision_size;
         std::memset(dst_ptr, 0, (end - begin )* sizeof(uint16_t));
@@ -195,61 +279,32 @@ void GNAPlugin::ExportScores(void *ptr_dst,
     // rotate if necessary and only copy actual scores (not padding)
     if (orientation == kDnnInterleavedOrientation) {
         if (num_bytes_per_element == 2) {
-            int16_t *dst = reinterpret_cast<int16_t *>(ptr_dst);
-            const int16_t *src = reinterpret_cast<const int16_t *>(ptr_src);
-            for (uint32_t i = 0; i < num_frames; i++) {
-                for (uint32_t j = 0; j < num_active_elements; j++) {
-                    dst[i * num_vector_elements + j] = src[j * num_group + i];
-                }
-                for (uint32_t j = num_active_elements; j < num_vector_elements; j++) {
-                    dst[i * num_vector_elements + j] = 0;
-                }
-            }
+            exportInterleaved(reinterpret_cast<int16_t *>(ptr_dst), reinterpret_cast<const int16_t *>(ptr_src),
+                              num_frames, num_group, num_vector_elements, num_active_elements);
         } else if (num_bytes_per_element == 4) {  // should work for both int and float
-            int32_t *dst = reinterpret_cast<int32_t *>(ptr_dst);
-            const int8_t *src = reinterpret_cast<const int8_t*>(ptr_src);
-            for (uint32_t i = 0; i < num_frames; i++) {
-                for (uint32_t j = 0; j < num_active_elements; j++) {
-                    auto input_ptr = src + (j * num_group + i) * num_bytes_per_element_input;
-                    auto dst_ptr = dst + (i * num_vector_elements + j);
-
-                    switch (num_bytes_per_element_input) {
-                        case 2 : {
-                            *dst_ptr  = static_cast<int32_t>(*reinterpret_cast<const int16_t*>(input_ptr));
-                            break;
-                        }
-                        case 4 : {
-                            *dst_ptr = *reinterpret_cast<const int32_t *>(input_ptr);
-                            break;
-                        }
-                        default:
-                            THROW_GNA_EXCEPTION << "Unsupported output layer precision: " << num_bytes_per_element_input << "bytes";
-                    }
+            auto dst = reinterpret_cast<int32_t *>(ptr_dst);
+            switch (num_bytes_per_element_input) {
+                case 2 : {
+                    exportInterleaved(dst, reinterpret_cast<const int16_t *>(ptr_src),
+                                      num_frames, num_group, num_vector_elements, num_active_elements);
+                    break;
                 }
-                for (uint32_t j = num_active_elements; j < num_vector_elements; j++) {
-                    dst[i * num_vector_elements + j] = 0;
+                case 4 : {
+                    exportInterleaved(dst, reinterpret_cast<const int32_t *>(ptr_src),
+                                      num_frames, num_group, num_vector_elements, num_active_elements);
+                    break;
                 }
+                default:
+                    THROW_GNA_EXCEPTION << "Unsupported output layer precision: " << num_bytes_per_element_input << "bytes";
             }
         } else {
             THROW_GNA_EXCEPTION << "Unsupported target precision for infer : " << num_bytes_per_element << "bytes";
         }
     } else {
         if (num_bytes_per_element == 2) {
-            for (uint32_t i = 0; i < num_frames; i++) {
-                auto ptr_dst_vec = reinterpret_cast<uint8_t *>(ptr_dst) + i * num_vector_elements * sizeof(int16_t);
-                auto ptr_src_vec = reinterpret_cast<const uint8_t *>(ptr_src) + i * num_vector_stride * sizeof(int16_t);
-                memset(ptr_dst_vec, 0, num_vector_elements * sizeof(int16_t));
-                ie_memcpy(ptr_dst_vec, num_active_elements * sizeof(int16_t),
-                    ptr_src_vec, num_active_elements * sizeof(int16_t));
-            }
+            exportDeinterleaved<int16_t>(ptr_dst, ptr_src, num_frames, num_vector_elements, num_active_elements, num_vector_stride);
         } else if (num_bytes_per_element == 4) {  // should work for both int and float
-            for (uint32_t i = 0; i < num_frames; i++) {
-                void *ptr_dst_vec = reinterpret_cast<uint8_t *>(ptr_dst) + i * num_vector_elements * sizeof(float);
-                const void *ptr_src_vec = reinterpret_cast<const uint8_t *>(ptr_src) + i * num_vector_stride * sizeof(float);
-                memset(ptr_dst_vec, 0, num_vector_elements * sizeof(float));
-                ie_memcpy(ptr_dst_vec, num_active_elements * sizeof(float),
-                    ptr_src_vec, num_active_elements * sizeof(float));
-            }
+            exportDeinterleaved<int32_t>(ptr_dst, ptr_src, num_frames, num_vector_elements, num_active_elements, num_vector_stride);
         } else {
             THROW_GNA_EXCEPTION << "Unsupported target precision for infer : " << num_bytes_per_element << "bytes";
         }
@@ -346,6 +401,12 @@ void GNAPlugin::InitGNADevice() {
                 gnaFlags->gna_lib_async_threads_num,
                 gnaFlags->gna_openmp_multithreading,
                 gnaFlags->performance_counting);
+    // in software emulation every library worker thread runs one request, give each parallel request its own worker,
+    // they use RW segments copied for parallel execution so do not interfere
+    if (gnaFlags->gna_lib_async_threads_num > 1 && !gnaFlags->gna_openmp_multithreading &&
+        gnadevice->isSoftwareEmulation(config.pluginGna2AccMode)) {
+        gnadevice->setNumberOfWorkerThreads(gnaFlags->gna_lib_async_threads_num);
+    }
 #endif
     size_t page_size_bytes = 4096;
     gnamem = std::make_shared<gna_memory_type>(memory::make_polymorph<memory::GNAAllocator>(gnadevice), page_size_bytes);
@@ -640,6 +701,7 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     }
 
     // CreatingLayer primitives
+    graphCompiler.PrecomputePwlDesigns(sortedNoMem);
     for (auto & layer : sortedNoMem) {
         graphCompiler.CreateLayerPrimitive(layer);
     }
@@ -785,15 +847,9 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     }
 
     // creating same gna RW segment for parallel infer requests
+    fp32Components.resize(gnaFlags->sw_fp32 ? gnaFlags->gna_lib_async_threads_num : 0);
+    fp32Requests.resize(fp32Components.size());
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
-#if GNA_LIB_VER == 2
-        gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
-#else
-        nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
-#endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
 
@@ -815,6 +871,39 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
             relocate(outputsDesc[j].ptrs[i], outputsDesc[j].ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            // float runtime executes the components directly, so each request gets a copy of them
+            // pointing to its own RW segment, read only weights, biases and segments stay shared
+            auto rwBegin = reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+            auto relocateRW = [&](void *& ptr) {
+                auto bytePtr = reinterpret_cast<uint8_t *>(ptr);
+                if (bytePtr >= rwBegin && bytePtr < rwBegin + rwSegmentSize) {
+                    relocate(ptr, ptr);
+                }
+            };
+            fp32Components[i] = dnn->component;
+            for (auto &component : fp32Components[i]) {
+                relocateRW(component.ptr_inputs);
+                relocateRW(component.ptr_outputs);
+                if (component.operation == kDnnRecurrentOp) {
+                    relocateRW(component.op.recurrent.ptr_feedbacks);
+                }
+            }
+#if GNA_LIB_VER == 1
+            nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
+#endif
+            continue;
+        }
+
+#if GNA_LIB_VER == 2
+        gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
+        // this can be improved by just copy all structures, but we are too lazy
+        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+#else
+        nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
+        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+#endif
+
 #if GNA_LIB_VER == 2
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
@@ -896,7 +985,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        // float runtime has a request slot for each of the parallel infer requests
+        const size_t requestsNum = std::max<size_t>(fp32Components.size(), 1);
+        for (size_t i = 0; i != requestsNum; i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -995,13 +1088,16 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
 #if GNA_LIB_VER == 2
     auto& nnets = gnaRequestConfigToRequestIdMap;
 #endif
+    std::unique_lock<std::mutex> lockRequestSlots{ requestSlotsSync };
     auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
         return std::get<1>(item) == -1;
     });
 
     if (freeNnet == nnets.end()) {
         if (!graphCompiler.memory_connection.empty()) {
+            lockRequestSlots.unlock();
             Wait(0);
+            lockRequestSlots.lock();
             freeNnet = nnets.begin();
         } else {
             THROW_IE_EXCEPTION << as_status << REQUEST_BUSY
@@ -1012,6 +1108,12 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
 
     auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
+    // infer requests may be started from different threads, slot is taken before inputs are staged
+    // and released if staging fails
+    using request_id_t = std::remove_reference<decltype(std::get<1>(nnets.front()))>::type;
+    RequestSlotReservation<request_id_t> reservation(freeNnet == nnets.end() ? nullptr : &std::get<1>(*freeNnet),
+                                                     requestSlotsSync);
+    lockRequestSlots.unlock();
 
     int inputNum = 0;
     for (auto &input : inputs) {
@@ -1097,20 +1199,27 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
 
     if (!gnadevice) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
-        if (freeNnet != nnets.end()) {
-            std::get<1>(*freeNnet) = 1;
+        if (fp32Components.size() > 1) {
+            // parallel requests run on their own threads and are synced in WaitFor
+            auto &components = idx == 0 ? dnn->component : fp32Components[idx];
+            auto fp32dnn = dnn;
+            fp32Requests[idx] = std::async(std::launch::async, [fp32dnn, &components] {
+                runtime::FP(fp32dnn, components).infer();
+            });
+        } else {
+            auto runtime = runtime::FP(dnn);
+            runtime.infer();
         }
+        reservation.commit(1);
     } else {
 #if GNA_LIB_VER == 1
         auto nnet = std::get<0>(*freeNnet).get();
-        std::get<1>(*freeNnet) = gnadevice->propagate(&nnet->obj, ptr_active_indices, num_active_indices, config.gna_proc_type);
+        reservation.commit(gnadevice->propagate(&nnet->obj, ptr_active_indices, num_active_indices, config.gna_proc_type));
 #else
         const auto reqConfigId = std::get<0>(*freeNnet);
         if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff)
             gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
-        std::get<1>(*freeNnet) = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
+        reservation.commit(gnadevice->propagate(reqConfigId, config.pluginGna2AccMode));
 #endif
     }
 
@@ -1138,21 +1247,47 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
 #endif
     // TODO: GNA2: check whether necessary
     if (nnets.size() <= request_idx) return GNA_REQUEST_COMPLETED;
-    // already synced TODO: might be copy required ???
-    if (std::get<1>(nnets[request_idx]) == -1) return GNA_REQUEST_COMPLETED;
 
+    // the slots are reserved and released by requests running on other threads
+    using request_id_t = std::remove_reference<decltype(std::get<1>(nnets.front()))>::type;
+    request_id_t requestId;
+    {
+        std::lock_guard<std::mutex> lockRequestSlots{ requestSlotsSync };
+        requestId = std::get<1>(nnets[request_idx]);
+    }
+    // already synced TODO: might be copy required ???
+    if (requestId == -1) return GNA_REQUEST_COMPLETED;
+    // inputs are still staged by the thread that started the request
+    if (requestId == RequestSlotReservation<request_id_t>::kReserved) return GNA_REQUEST_PENDING;
+
+    // slot is given back only once outputs are exported, request started from other thread could overwrite them
+    auto releaseRequestSlot = [&] {
+        std::lock_guard<std::mutex> lockRequestSlots{ requestSlotsSync };
+        std::get<1>(nnets[request_idx]) = -1;
+    };
     if (gnadevice) {
-        const auto waitStatus = gnadevice->wait(std::get<1>(nnets[request_idx]), millisTimeout);
+        const auto waitStatus = gnadevice->wait(requestId, millisTimeout);
         if (waitStatus == GNA_REQUEST_ABORTED) {
-            std::get<1>(nnets[request_idx]) = -1;
+            releaseRequestSlot();
             return GNA_REQUEST_ABORTED;
         }
         if (waitStatus == GNA_REQUEST_PENDING) {
             return GNA_REQUEST_PENDING;
         }
+    } else if (request_idx < fp32Requests.size() && fp32Requests[request_idx].valid()) {
+        auto &fp32Request = fp32Requests[request_idx];
+        if (fp32Request.wait_for(std::chrono::milliseconds(millisTimeout)) != std::future_status::ready) {
+            return GNA_REQUEST_PENDING;
+        }
+        try {
+            // rethrows the errors of the float runtime
+            fp32Request.get();
+        } catch (...) {
+            releaseRequestSlot();
+            throw;
+        }
     }
 
-    std::get<1>(nnets[request_idx]) = -1;
     auto &request = std::get<2>(nnets[request_idx]);
 #ifdef PLOT
     if (dnn->num_components() != 0) {
@@ -1249,12 +1384,14 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
 #endif
             }
         } else {
+            releaseRequestSlot();
             THROW_GNA_EXCEPTION << "Expected output blob to have Layout::NC, Layout::CN, Layout::NCHW or Layout::CHW. But was "
                 << outputBlob->getTensorDesc().getLayout();
         }
 
         output_idx++;
     }
+    releaseRequestSlot();
     return GNA_REQUEST_COMPLETED;
 }
 
@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <future>
 #include <map>
 #include <unordered_map>
 #include <list>
 #include <string>
 #include <utility>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <tuple>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
@@ -85,6 +87,18 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     uint32_t rwSegmentSize = 0;
 
+    /**
+     * @brief components of the float runtime relocated to RW segments of parallel infer requests,
+     * first request uses components of dnn itself
+     */
+    std::vector<std::vector<intel_dnn_component_t>> fp32Components;
+    std::vector<std::future<void>> fp32Requests;
+
+    /**
+     * @brief guards lookup of a free request slot, infer requests may be started from different threads
+     */
+    std::mutex requestSlotsSync;
+
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
     std::vector<InferenceEngine::VariableStateInternal::Ptr> memoryStates;
@@ -4,6 +4,11 @@
 
 #include "preprocessing.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GNA_PREPROCESSING_SSE2
+#include <emmintrin.h>
+#endif
+
 int16_t GNAPluginNS::ConvertFloatToInt16(float src) {
     float rounding_value = (src > 0) ? 0.5f : -0.5f;
     float value = src + rounding_value;
@@ -15,6 +20,35 @@ int16_t GNAPluginNS::ConvertFloatToInt16(float src) {
     return (int16_t)value;
 }
 
+void GNAPluginNS::ConvertFloatToInt16(int16_t *ptr_dst,
+                                      const float *ptr_src,
+                                      size_t num_elements,
+                                      float scale_factor) {
+    size_t i = 0;
+#ifdef GNA_PREPROCESSING_SSE2
+    const __m128 scale = _mm_set1_ps(scale_factor);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 lower = _mm_set1_ps(-32768.0f);
+    const __m128 upper = _mm_set1_ps(32767.0f);
+    auto quantize = [&](const float *src) {
+        __m128 value = _mm_mul_ps(_mm_loadu_ps(src), scale);
+        // same rounding as the scalar version: +0.5 for positive values, -0.5 otherwise
+        __m128 rounding = _mm_or_ps(half, _mm_andnot_ps(_mm_cmpgt_ps(value, zero), sign));
+        value = _mm_min_ps(_mm_max_ps(_mm_add_ps(value, rounding), lower), upper);
+        return _mm_cvttps_epi32(value);
+    };
+    for (; i + 8 <= num_elements; i += 8) {
+        __m128i packed = _mm_packs_epi32(quantize(ptr_src + i), quantize(ptr_src + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr_dst + i), packed);
+    }
+#endif
+    for (; i < num_elements; i++) {
+        ptr_dst[i] = ConvertFloatToInt16(ptr_src[i] * scale_factor);
+    }
+}
+
 void GNAPluginNS::ConvertToInt16(int16_t *ptr_dst,
                                  const float *ptr_src,
                                  const uint32_t num_rows,
@@ -23,9 +57,7 @@ void GNAPluginNS::ConvertToInt16(int16_t *ptr_dst,
     if (!ptr_dst || !ptr_src) {
         return;
     }
-    for (uint32_t i = 0; i < num_rows*num_columns; i++) {
-        ptr_dst[i] = GNAPluginNS::ConvertFloatToInt16(ptr_src[i]*scale_factor);
-    }
+    ConvertFloatToInt16(ptr_dst, ptr_src, static_cast<size_t>(num_rows) * num_columns, scale_factor);
 }
 
 void GNAPluginNS::ConvertToFloat(float *ptr_dst,
@@ -39,7 +71,16 @@ void GNAPluginNS::ConvertToFloat(float *ptr_dst,
     for (uint32_t i = 0; i < num_rows; i++) {
         int32_t *ptr_int_row = ptr_src + i * num_columns;
         float *ptr_float_row = ptr_dst + i * num_columns;
-        for (uint32_t j = 0; j < num_columns; j++) {
+        uint32_t j = 0;
+#ifdef GNA_PREPROCESSING_SSE2
+        // conversion is done in place, so the whole vector is loaded before it is stored
+        const __m128 scale = _mm_set1_ps(scale_factor);
+        for (; j + 4 <= num_columns; j += 4) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr_int_row + j));
+            _mm_storeu_ps(ptr_float_row + j, _mm_div_ps(_mm_cvtepi32_ps(value), scale));
+        }
+#endif
+        for (; j < num_columns; j++) {
             ptr_float_row[j] = static_cast<float>(ptr_int_row[j]) / scale_factor;
         }
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace GNAPluginNS {
@@ -21,4 +22,13 @@ void ConvertToFloat(float *ptr_dst,
                     const float scale_factor);
 
 int16_t ConvertFloatToInt16(float src);
+
+/**
+ * @brief Quantizes src * scale_factor to int16 with the rounding and saturation of ConvertFloatToInt16(float),
+ * uses SSE2 where available
+ */
+void ConvertFloatToInt16(int16_t *ptr_dst,
+                         const float *ptr_src,
+                         size_t num_elements,
+                         float scale_factor);
 }  // namespace GNAPluginNS
@@ -8,6 +8,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 
 
@@ -30,17 +31,19 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
+    // every output position is a dot product of an input band with each of the filters,
+    // so the whole convolution is a single product of the bands and the transposed filters
+    uint32_t num_filters = component->op.conv1D.num_filters;
     for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            ptr_outputs[j * num_filters + i] = ptr_biases[i];
         }
     }
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans,
+                 num_filter_outputs, num_filters, num_filter_coefficients, 1.0f,
+                 ptr_inputs, num_inputs_band_stride,
+                 ptr_filters, num_filter_coefficients,
+                 1.0f, ptr_outputs, num_filters);
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -1,14 +1,117 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the GNA_SW_FP32 runtime
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 #include "floatmath.h"
 
+namespace {
+
+// Independent partial sums per dot product: enough to fill a vector register and to hide the
+// latency of the additions. The lanes are reduced in a fixed order, so the results do not
+// depend on the number of threads.
+constexpr int kDotLanes = 8;
+// Columns of the result computed together, every loaded element of A is used that many times
+constexpr int kColumnBlock = 4;
+// Smaller products are not worth waking up the worker threads
+constexpr int64_t kMinParallelMacs = 1 << 16;
+
+template <int J>
+inline void dot_block(const float *a, const float * const *b, const int k, float *sums) {
+    float acc[J][kDotLanes] = {};
+    int p = 0;
+    for (; p + kDotLanes <= k; p += kDotLanes) {
+        for (int j = 0; j < J; j++) {
+            for (int l = 0; l < kDotLanes; l++) {
+                acc[j][l] += a[p + l] * b[j][p + l];
+            }
+        }
+    }
+    for (int j = 0; j < J; j++) {
+        float sum = 0.0f;
+        for (int l = 0; l < kDotLanes; l++) {
+            sum += acc[j][l];
+        }
+        for (int q = p; q < k; q++) {
+            sum += a[q] * b[j][q];
+        }
+        sums[j] = sum;
+    }
+}
+
+/**
+ * C[l, n] = c_scale * C[l, n] + alpha * dot(A[a_rows[l], :], Bt[b_rows[n], :])
+ * where both operands are read along contiguous rows; a null row list selects all the rows.
+ * Rows of C are distributed across threads.
+ */
+void gemm_rows(const int M, const int N, const int K, const float alpha,
+               const float *A, const int lda, const uint32_t *a_rows,
+               const float *Bt, const int ldbt, const uint32_t *b_rows,
+               const float c_scale, float *C, const int ldc) {
+    const int64_t macs = static_cast<int64_t>(M) * N * K;
+    InferenceEngine::parallel_nt(macs < kMinParallelMacs ? 1 : 0, [&](int ithr, int nthr) {
+        int start = 0, end = 0;
+        InferenceEngine::splitter(M, nthr, ithr, start, end);
+        auto b_row = [&](int n) {
+            return Bt + static_cast<size_t>(b_rows == nullptr ? n : b_rows[n]) * ldbt;
+        };
+        auto store = [&](float *c, float sum) {
+            // zero scale must not propagate garbage from the uninitialized output
+            *c = (c_scale == 0.0f ? 0.0f : c_scale * *c) + alpha * sum;
+        };
+        for (int l = start; l < end; l++) {
+            const float *a = A + static_cast<size_t>(a_rows == nullptr ? l : a_rows[l]) * lda;
+            float *c = C + static_cast<size_t>(l) * ldc;
+            int n = 0;
+            for (; n + kColumnBlock <= N; n += kColumnBlock) {
+                const float *b[kColumnBlock];
+                float sums[kColumnBlock];
+                for (int j = 0; j < kColumnBlock; j++) {
+                    b[j] = b_row(n + j);
+                }
+                dot_block<kColumnBlock>(a, b, K, sums);
+                for (int j = 0; j < kColumnBlock; j++) {
+                    store(c + n + j, sums[j]);
+                }
+            }
+            for (; n < N; n++) {
+                const float *b[1] = {b_row(n)};
+                float sum;
+                dot_block<1>(a, b, K, &sum);
+                store(c + n, sum);
+            }
+        }
+    });
+}
+
+/**
+ * Returns the columns of the K x N matrix B as contiguous rows, the buffer is reused by the
+ * following calls on the same thread
+ */
+const float *transpose_b(const float *B, const int ldb, const int K, const int N) {
+    if (N == 1 && ldb == 1) {
+        return B;
+    }
+    static thread_local std::vector<float> transposed;
+    transposed.resize(static_cast<size_t>(N) * K);
+    for (int k = 0; k < K; k++) {
+        const float *b = B + static_cast<size_t>(k) * ldb;
+        for (int n = 0; n < N; n++) {
+            transposed[static_cast<size_t>(n) * K + k] = b[n];
+        }
+    }
+    return transposed.data();
+}
+
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -27,26 +130,10 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        gemm_rows(M, N, K, 1.0f, A, lda, nullptr, transpose_b(B, ldb, K, N), K, nullptr,
+                  (beta == 1.0) ? 1.0f : 0.0f, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        gemm_rows(M, N, K, alpha, A, lda, nullptr, B, ldb, nullptr, beta, C, ldc);
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,28 +192,10 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        gemm_rows(L, N, K, 1.0f, A, lda, OutputList, transpose_b(B, ldb, K, N), K, nullptr,
+                  (beta == 1.0) ? 1.0f : 0.0f, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
-                }
-                C[i * ldc + l] = sum;
-            }
-        }
+        gemm_rows(M, L, K, alpha, A, lda, nullptr, B, ldb, OutputList, beta, C, ldc);
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (l = 0; l < L; l++) {
             i = OutputList[l];
@@ -153,20 +222,21 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    const uint32_t num_columns = K1 + K2;
+    const int64_t macs = static_cast<int64_t>(N) * num_columns;
+
+    InferenceEngine::parallel_nt(macs < kMinParallelMacs ? 1 : 0, [&](int ithr, int nthr) {
+        uint32_t start = 0, end = 0;
+        InferenceEngine::splitter(N, nthr, ithr, start, end);
+        for (uint32_t i = start; i < end; i++) {
+            const float *x[1] = {X + static_cast<size_t>(i) * num_columns};
+            float sum1, sum2;
+            dot_block<1>(A1, x, K1, &sum1);
+            x[0] += K1;
+            dot_block<1>(A2, x, K2, &sum2);
+            C[i] = B[i] + sum1 + sum2;
         }
-        C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
@@ -3,6 +3,8 @@
 //
 
 #pragma once
+#include <memory>
+#include <vector>
 #include <backend/am_intel_dnn.hpp>
 
 namespace GNAPluginNS {
@@ -12,8 +14,15 @@ namespace runtime {
  */
 class FP {
     std::shared_ptr<backend::AMIntelDNN> dnn;
+    std::vector<intel_dnn_component_t> *components;
  public:
-    FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn), components(&dnn->component) {
+    }
+    /**
+     * @brief runs the dnn on a copy of its components with pointers relocated to the memory of a parallel infer request
+     */
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn, std::vector<intel_dnn_component_t> &components)
+        : dnn(dnn), components(&components) {
     }
     virtual void infer();
 
@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <exception>
+#include <mutex>
+#include <ie_parallel.hpp>
 #include "backend/gna_types.h"
 
 #ifdef _NO_MKL_
@@ -931,11 +934,59 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+static void PwlApply32Block(intel_dnn_component_t *component,
+                            uint32_t num_row_start,
+                            uint32_t num_row_end,
+                            uint32_t num_col_start,
+                            uint32_t num_col_end);
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
+    // smaller activations are not worth waking up the worker threads
+    constexpr uint64_t min_parallel_elements = 4096;
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_cols = num_col_end - num_col_start + 1;
+    if (static_cast<uint64_t>(num_rows) * num_cols < min_parallel_elements) {
+        PwlApply32Block(component, num_row_start, num_row_end, num_col_start, num_col_end);
+        return;
+    }
+
+    // elements are independent, so the rows are split across threads, or the columns for
+    // the interleaved activations that only have a few rows
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    InferenceEngine::parallel_nt(0, [&](int ithr, int nthr) {
+        const bool split_rows = num_rows >= static_cast<uint32_t>(nthr);
+        uint32_t start = 0, end = 0;
+        InferenceEngine::splitter(split_rows ? num_rows : num_cols, static_cast<uint32_t>(nthr),
+                                  static_cast<uint32_t>(ithr), start, end);
+        if (start == end) {
+            return;
+        }
+        try {
+            if (split_rows) {
+                PwlApply32Block(component, num_row_start + start, num_row_start + end - 1, num_col_start, num_col_end);
+            } else {
+                PwlApply32Block(component, num_row_start, num_row_end, num_col_start + start, num_col_start + end - 1);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            error = std::current_exception();
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+static void PwlApply32Block(intel_dnn_component_t *component,
+                            uint32_t num_row_start,
+                            uint32_t num_row_end,
+                            uint32_t num_col_start,
+                            uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <set>
+#include <utility>
+
+#include <ie_parallel.hpp>
+
+#include "runtime/pwl.h"
+#include "runtime/pwl_design_cache.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+PwlDesignCache& PwlDesignCache::instance() {
+    static PwlDesignCache cache;
+    return cache;
+}
+
+bool PwlDesignCache::isCacheable(const DnnActivation &activation) {
+    // fake quantize arguments point to per channel ranges, custom activations are not designed at all
+    return activation.type != kActFakeQuantize && activation.type != kActCustom;
+}
+
+PwlDesignCache::Key PwlDesignCache::makeKey(const DnnActivation &activation, float scale_in, float scale_out) {
+    if (activation.type == kActPow) {
+        return Key(activation.type, activation.args.pow.exponent, activation.args.pow.scale, activation.args.pow.offset,
+                   scale_in, scale_out);
+    }
+    return Key(activation.type, activation.args.lrelu.negative_slope, 0.0f, 0.0f, scale_in, scale_out);
+}
+
+void PwlDesignCache::design(const DnnActivation &activation,
+                            std::vector<gna_pwl_segment_t> &segments,
+                            float scale_in,
+                            float scale_out) {
+    if (!isCacheable(activation)) {
+        PwlDesignOpt16(activation, segments, scale_in, scale_out);
+        return;
+    }
+    auto key = makeKey(activation, scale_in, scale_out);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = designs.find(key);
+        if (found != designs.end()) {
+            segments = found->second;
+            return;
+        }
+    }
+    std::vector<gna_pwl_segment_t> designed;
+    PwlDesignOpt16(activation, designed, scale_in, scale_out);
+    segments = designed;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    designs.emplace(std::move(key), std::move(designed));
+}
+
+PwlDesignCache::Statistics PwlDesignCache::precompute(const std::vector<Request> &requests) {
+    Statistics statistics;
+    statistics.requested = requests.size();
+
+    std::vector<Request> missing;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::set<Key> seen;
+        for (auto &&request : requests) {
+            if (!isCacheable(request.activation)) {
+                continue;
+            }
+            auto key = makeKey(request.activation, request.scale_in, request.scale_out);
+            if (designs.count(key) == 0 && seen.insert(key).second) {
+                missing.push_back(request);
+            }
+        }
+    }
+    statistics.designed = missing.size();
+
+    InferenceEngine::parallel_for(missing.size(), [&](size_t i) {
+        std::vector<gna_pwl_segment_t> segments;
+        try {
+            design(missing[i].activation, segments, missing[i].scale_in, missing[i].scale_out);
+        } catch (...) {
+        }
+    });
+    return statistics;
+}
+
+size_t PwlDesignCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return designs.size();
+}
+
+void PwlDesignCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    designs.clear();
+}
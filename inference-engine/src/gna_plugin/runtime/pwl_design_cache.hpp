@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "backend/dnn_types.h"
+#include "backend/gna_types.h"
+
+namespace GNAPluginNS {
+namespace runtime {
+/**
+ * @brief Memoizes PwlDesignOpt16 segments by activation and input/output scale factors.
+ * The cache is shared by all networks loaded in the process, so reloading a network or loading
+ * networks with the same activations and scale factors reuses the designs
+ */
+class PwlDesignCache {
+ public:
+    struct Request {
+        DnnActivation activation;
+        float scale_in;
+        float scale_out;
+    };
+
+    struct Statistics {
+        size_t requested = 0;
+        size_t designed = 0;
+    };
+
+    static PwlDesignCache& instance();
+
+    /**
+     * @brief fills segments with the design of the activation, computing it if it is not in the cache
+     */
+    void design(const DnnActivation &activation,
+                std::vector<gna_pwl_segment_t> &segments,
+                float scale_in,
+                float scale_out);
+
+    /**
+     * @brief designs the distinct requests that are not in the cache yet in parallel
+     * design errors are ignored here, they are reported by the later design() of the same activation
+     */
+    Statistics precompute(const std::vector<Request> &requests);
+
+    size_t size() const;
+    void clear();
+
+ private:
+    // type, pow exponent or relu negative slope, pow scale, pow offset, input and output scale factors
+    using Key = std::tuple<int, float, float, float, float, float>;
+
+    static bool isCacheable(const DnnActivation &activation);
+    static Key makeKey(const DnnActivation &activation, float scale_in, float scale_out);
+
+    mutable std::mutex mutex;
+    std::map<Key, std::vector<gna_pwl_segment_t>> designs;
+};
+}  // namespace runtime
+}  // namespace GNAPluginNS
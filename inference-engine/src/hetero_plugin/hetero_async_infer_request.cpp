@@ -4,6 +4,7 @@
 
 #include <utility>
 #include <memory>
+#include <string>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -16,6 +17,57 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)),
     _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK} {
     _pipeline.clear();
+    if (_heteroInferRequest->isPipelined()) {
+        // every stage borrows a subgraph request from the pool, so the devices can process different infer requests at once
+        for (std::size_t stage = 0; stage < _heteroInferRequest->_inferRequests.size(); ++stage) {
+            struct StageExecutor : ITaskExecutor {
+                StageExecutor(HeteroInferRequest* heteroInferRequest, const std::size_t stage) :
+                    _heteroInferRequest{heteroInferRequest}, _stage{stage} {}
+                void run(Task task) override {
+                    auto heteroInferRequest = _heteroInferRequest;
+                    auto stage = _stage;
+                    heteroInferRequest->_subRequestPools[stage]->Acquire(
+                    [heteroInferRequest, stage, task] (SubRequestPool::Worker* worker) {
+                        heteroInferRequest->_workers[stage] = worker;
+                        worker->_task = task;
+                        worker->_status = StatusCode::OK;
+                        worker->_exception = nullptr;
+                        try {
+                            heteroInferRequest->bindStageBlobs(stage);
+                            worker->_request->StartAsync();
+                        } catch (...) {
+                            worker->_status = StatusCode::GENERAL_ERROR;
+                            worker->_exception = std::current_exception();
+                            auto capturedTask = std::move(worker->_task);
+                            capturedTask();
+                        }
+                    });
+                };
+                HeteroInferRequest* _heteroInferRequest = nullptr;
+                std::size_t         _stage = 0;
+            };
+
+            auto heteroInferRequest = _heteroInferRequest.get();
+            _pipeline.emplace_back(std::make_shared<StageExecutor>(heteroInferRequest, stage), [heteroInferRequest, stage] {
+                auto worker = heteroInferRequest->_workers[stage];
+                auto status = worker->_status;
+                auto exception = worker->_exception;
+                if (StatusCode::OK == status && heteroInferRequest->_needPerfCounters) {
+                    for (auto&& r : worker->_request->GetPerformanceCounts()) {
+                        heteroInferRequest->_perfMap[std::string("subgraph") + std::to_string(stage) + ": " + r.first] = r.second;
+                    }
+                }
+                // the worker can be borrowed by another request right after the release
+                heteroInferRequest->releaseStageWorkers(stage, StatusCode::OK != status);
+                if (nullptr != exception) {
+                    std::rethrow_exception(exception);
+                } else if (StatusCode::OK != status) {
+                    THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+                }
+            });
+        }
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
@@ -45,17 +97,31 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
 }
 
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
-    _heteroInferRequest->updateInOutIfNeeded();
+    if (_heteroInferRequest->isPipelined()) {
+        _heteroInferRequest->_perfMap.clear();
+    } else {
+        _heteroInferRequest->updateInOutIfNeeded();
+    }
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    if (_heteroInferRequest->isPipelined()) {
+        InferUsingAsync();
+    } else {
+        AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+    }
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch(...) {
-        for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
-            requestDesc._request->Wait(IInferRequest::RESULT_READY);
+        if (!_heteroInferRequest->isPipelined()) {
+            for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
+                requestDesc._request->Wait(IInferRequest::RESULT_READY);
+            }
         }
         throw;
     }
@@ -392,6 +392,25 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                             });
         ++id;
     }
+    // negotiate the same precision and layout on both sides of every subgraph boundary,
+    // so the producer output blob is passed to the consumer as is, without a conversion
+    for (auto&& consumer : networks) {
+        for (auto&& consumerInput : consumer._clonedNetwork.getInputsInfo()) {
+            auto itProducerOutputName = _blobNameMap.find(consumerInput.first);
+            if (itProducerOutputName == _blobNameMap.end()) {
+                continue;
+            }
+            for (auto&& producer : networks) {
+                auto producerOutputs = producer._clonedNetwork.getOutputsInfo();
+                auto itProducerOutput = producerOutputs.find(itProducerOutputName->second);
+                if (itProducerOutput != producerOutputs.end()) {
+                    consumerInput.second->setPrecision(itProducerOutput->second->getPrecision());
+                    consumerInput.second->setLayout(itProducerOutput->second->getLayout());
+                    break;
+                }
+            }
+        }
+    }
     if (dumpDotFile) {
         ngraph::pass::VisualizeTree{"hetero_subgraphs_" + _name + ".dot",
             [&] (const ngraph::Node& node, std::vector<std::string>& attributes) {
@@ -420,6 +439,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
                                                                  network._device, metaDevices[network._device]);
     }
+    InitSubRequestPools(_config);
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -542,6 +562,32 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     }
 
     networks = std::move(descs);
+    InitSubRequestPools(importedConfigs);
+}
+
+void HeteroExecutableNetwork::InitSubRequestPools(const std::map<std::string, std::string>& config) {
+    auto itPerfCount = config.find(CONFIG_KEY(PERF_COUNT));
+    _needPerfCounters = (itPerfCount != config.end()) && (itPerfCount->second == YES);
+    auto itDepth = config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (itDepth == config.end()) {
+        return;
+    }
+    int depth = 0;
+    try {
+        depth = std::stoi(itDepth->second);
+    } catch (...) {
+        depth = -1;
+    }
+    if (depth < 0) {
+        THROW_IE_EXCEPTION << "Wrong value for " << HETERO_CONFIG_KEY(PIPELINE_DEPTH) << ": " << itDepth->second
+                           << ". Expected a non-negative integer";
+    }
+    _pipelineDepth = static_cast<unsigned int>(depth);
+    if (0 != _pipelineDepth) {
+        for (auto&& subnetwork : networks) {
+            _subRequestPools.push_back(std::make_shared<SubRequestPool>(subnetwork._network, _pipelineDepth));
+        }
+    }
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
@@ -630,10 +676,13 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
-    return std::make_shared<HeteroInferRequest>(networkInputs,
-                                                networkOutputs,
-                                                inferRequests,
-                                                _blobNameMap);
+    auto heteroInferRequest = std::make_shared<HeteroInferRequest>(networkInputs,
+                                                                   networkOutputs,
+                                                                   inferRequests,
+                                                                   _blobNameMap,
+                                                                   _subRequestPools);
+    heteroInferRequest->_needPerfCounters = _needPerfCounters;
+    return heteroInferRequest;
 }
 
 IInferRequest::Ptr HeteroExecutableNetwork::CreateInferRequest() {
@@ -654,6 +703,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        result = _pipelineDepth;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -738,6 +789,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
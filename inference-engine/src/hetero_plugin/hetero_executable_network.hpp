@@ -63,6 +63,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitSubRequestPools(const std::map<std::string, std::string>& config);
 
     struct NetworkDesc {
         std::string                                 _device;
@@ -75,6 +76,9 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    unsigned int                        _pipelineDepth = 0;
+    bool                                _needPerfCounters = false;
+    std::vector<SubRequestPool::Ptr>    _subRequestPools;
 };
 
 }  // namespace HeteroPlugin
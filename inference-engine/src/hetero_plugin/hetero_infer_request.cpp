@@ -6,26 +6,123 @@
 #include "hetero_itt.hpp"
 #include <ie_blob.h>
 #include <description_buffer.hpp>
+#include <blob_factory.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+SubRequestPool::SubRequestPool(InferenceEngine::ExecutableNetwork network, const std::size_t depth) :
+    _workers(depth) {
+    for (auto&& worker : _workers) {
+        auto* workerPtr = &worker;
+        worker._request = network.CreateInferRequestPtr();
+        worker._request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [workerPtr] (InferRequest, StatusCode status) mutable {
+                workerPtr->_status = status;
+                auto capturedTask = std::move(workerPtr->_task);
+                capturedTask();
+            });
+        _idleWorkers.push_back(workerPtr);
+    }
+}
+
+void SubRequestPool::Acquire(OnAcquired onAcquired) {
+    Worker* worker = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_idleWorkers.empty()) {
+            // the request is served by the worker that is released next
+            _pendingAcquires.push_back(std::move(onAcquired));
+            return;
+        }
+        worker = _idleWorkers.front();
+        _idleWorkers.pop_front();
+    }
+    onAcquired(worker);
+}
+
+void SubRequestPool::Release(Worker* worker) {
+    OnAcquired onAcquired;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_pendingAcquires.empty()) {
+            _idleWorkers.push_back(worker);
+            return;
+        }
+        onAcquired = std::move(_pendingAcquires.front());
+        _pendingAcquires.pop_front();
+    }
+    onAcquired(worker);
+}
+
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        const SubRequestsList& inferRequests,
-                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) :
+                                       const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames,
+                                       const std::vector<SubRequestPool::Ptr>& subRequestPools) :
     InferRequestInternal(networkInputs, networkOutputs),
-    _inferRequests(inferRequests) {
+    _inferRequests(inferRequests),
+    _subRequestPools(subRequestPools),
+    _subgraphInputToOutputBlobNames(subgraphInputToOutputBlobNames) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
 
+    if (isPipelined()) {
+        // subgraph requests are borrowed from the pools, so the request owns just the network inputs and outputs
+        // and remembers when every borrowed subgraph request can be returned: after the last subgraph that reads its outputs
+        IE_ASSERT(_subRequestPools.size() == _inferRequests.size());
+        _workers.resize(_inferRequests.size(), nullptr);
+        _releaseAfterStage.resize(_inferRequests.size());
+        for (std::size_t stage = 0; stage < _inferRequests.size(); ++stage) {
+            for (auto&& outputInfo : _inferRequests[stage]._network.GetOutputsInfo()) {
+                _producerStages.emplace(outputInfo.first, stage);
+            }
+        }
+        std::vector<std::size_t> lastConsumerStages(_inferRequests.size());
+        for (std::size_t stage = 0; stage < _inferRequests.size(); ++stage) {
+            lastConsumerStages[stage] = stage;
+            for (auto&& inputInfo : _inferRequests[stage]._network.GetInputsInfo()) {
+                if (contains(_networkInputs, inputInfo.first)) {
+                    continue;
+                }
+                // the borrowed consumer request always gets the blob of the producer request
+                const auto& desc = inputInfo.second->getTensorDesc();
+                _boundaries[inputInfo.first] = {product(desc.getDims()) * desc.getPrecision().size(), true};
+                auto itName = _subgraphInputToOutputBlobNames.find(inputInfo.first);
+                auto itProducer = _producerStages.find(
+                    itName != _subgraphInputToOutputBlobNames.end() ? itName->second : inputInfo.first);
+                if (itProducer != _producerStages.end()) {
+                    lastConsumerStages[itProducer->second] = std::max(lastConsumerStages[itProducer->second], stage);
+                }
+            }
+        }
+        for (std::size_t stage = 0; stage < _inferRequests.size(); ++stage) {
+            _releaseAfterStage[lastConsumerStages[stage]].push_back(stage);
+        }
+        for (auto&& networkInput : _networkInputs) {
+            auto blob = make_blob_with_precision(networkInput.second->getTensorDesc());
+            blob->allocate();
+            _inputs[networkInput.first] = blob;
+        }
+        for (auto&& networkOutput : _networkOutputs) {
+            auto blob = make_blob_with_precision(networkOutput.second->getTensorDesc());
+            blob->allocate();
+            _outputs[networkOutput.first] = blob;
+        }
+        return;
+    }
+
     auto requestBlob([&](const std::string& blobName, InferenceEngine::InferRequest::Ptr r) {
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
@@ -44,6 +141,10 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
             }
         } else {
             r->SetBlob(blobName, itBlob->second);
+            if (itName != subgraphInputToOutputBlobNames.end()) {
+                // the consumer that did not keep the producer blob has it copied on every inference
+                _boundaries[blobName] = {itBlob->second->byteSize(), r->GetBlob(blobName) == itBlob->second};
+            }
         }
     });
 
@@ -66,6 +167,10 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
 
 void HeteroInferRequest::SetBlob(const char* name, const InferenceEngine::Blob::Ptr& data) {
     InferenceEngine::InferRequestInternal::SetBlob(name, data);
+    if (isPipelined()) {
+        // the blob is passed to the borrowed subgraph request when the corresponding subgraph is started
+        return;
+    }
     assert(!_inferRequests.empty());
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
@@ -86,6 +191,9 @@ void HeteroInferRequest::SetBlob(const char* name, const InferenceEngine::Blob::
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (isPipelined()) {
+        THROW_IE_EXCEPTION << "Internal error: pipelined HETERO infer request can be executed only asynchronously";
+    }
     updateInOutIfNeeded();
     size_t i = 0;
     for (auto &&desc : _inferRequests) {
@@ -97,6 +205,11 @@ void HeteroInferRequest::InferImpl() {
 }
 
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    if (isPipelined()) {
+        perfMap = _perfMap;
+        addBoundaryPerfCounts(perfMap);
+        return;
+    }
     perfMap.clear();
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
@@ -104,6 +217,19 @@ void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEng
             perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
         }
     }
+    addBoundaryPerfCounts(perfMap);
+}
+
+void HeteroInferRequest::addBoundaryPerfCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    for (auto&& boundary : _boundaries) {
+        InferenceEngineProfileInfo info = {};
+        info.status = boundary.second._sharedBlob ? InferenceEngineProfileInfo::NOT_RUN : InferenceEngineProfileInfo::EXECUTED;
+        auto execType = (boundary.second._sharedBlob ? std::string{"shared_"} : std::string{"copy_"}) +
+                        std::to_string(boundary.second._byteSize) + "_bytes";
+        std::strncpy(info.exec_type, execType.c_str(), sizeof(info.exec_type) - 1);
+        std::strncpy(info.layer_type, "HeteroBoundary", sizeof(info.layer_type) - 1);
+        perfMap["boundary: " + boundary.first] = info;
+    }
 }
 
 void HeteroInferRequest::updateInOutIfNeeded() {
@@ -142,3 +268,53 @@ void HeteroInferRequest::updateInOutIfNeeded() {
         }
     }
 }
+
+bool HeteroInferRequest::isPipelined() const {
+    return !_subRequestPools.empty();
+}
+
+void HeteroInferRequest::bindStageBlobs(const std::size_t stage) {
+    auto& desc = _inferRequests[stage];
+    auto& r = _workers[stage]->_request;
+    assert(nullptr != r);
+    for (auto&& inputInfo : desc._network.GetInputsInfo()) {
+        auto& ioname = inputInfo.first;
+        if (contains(_networkInputs, ioname)) {
+            auto itPreProc = _preProcData.find(ioname);
+            auto blob = (itPreProc != _preProcData.end()) ? itPreProc->second->getRoiBlob() : _inputs.at(ioname);
+            r->SetBlob(ioname, blob, _networkInputs.at(ioname)->getPreProcess());
+        } else {
+            // intermediate blob is shared with the subgraph request that produced it, so no copy is made
+            auto itName = _subgraphInputToOutputBlobNames.find(ioname);
+            auto& producerName = (itName != _subgraphInputToOutputBlobNames.end()) ? itName->second : ioname;
+            auto producerWorker = _workers[_producerStages.at(producerName)];
+            assert(nullptr != producerWorker);
+            r->SetBlob(ioname, producerWorker->_request->GetBlob(producerName));
+        }
+    }
+    for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
+        auto& ioname = outputInfo.first;
+        if (contains(_networkOutputs, ioname)) {
+            r->SetBlob(ioname, _outputs.at(ioname));
+        }
+    }
+}
+
+void HeteroInferRequest::releaseStageWorkers(const std::size_t completedStage, const bool releaseAll) {
+    auto release = [&] (const std::size_t stage) {
+        if (nullptr != _workers[stage]) {
+            auto worker = _workers[stage];
+            _workers[stage] = nullptr;
+            _subRequestPools[stage]->Release(worker);
+        }
+    };
+    if (releaseAll) {
+        for (std::size_t stage = 0; stage < _workers.size(); ++stage) {
+            release(stage);
+        }
+    } else {
+        for (auto&& stage : _releaseAfterStage[completedStage]) {
+            release(stage);
+        }
+    }
+}
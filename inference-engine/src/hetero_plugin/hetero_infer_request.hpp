@@ -9,7 +9,11 @@
 
 #pragma once
 
+#include <deque>
+#include <exception>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <memory>
@@ -22,6 +26,33 @@
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Pool of infer requests to a single subgraph shared by all the infer requests of the executable network.
+ * A request that asks for a subgraph request when all of them are busy is served by the next released one.
+ */
+class SubRequestPool {
+public:
+    using Ptr = std::shared_ptr<SubRequestPool>;
+    struct Worker {
+        InferenceEngine::InferRequest::Ptr  _request;
+        InferenceEngine::Task               _task;
+        InferenceEngine::StatusCode         _status = InferenceEngine::StatusCode::OK;
+        std::exception_ptr                  _exception = nullptr;
+    };
+    using OnAcquired = std::function<void(Worker*)>;
+
+    SubRequestPool(InferenceEngine::ExecutableNetwork network, const std::size_t depth);
+
+    void Acquire(OnAcquired onAcquired);
+    void Release(Worker* worker);
+
+private:
+    std::vector<Worker>     _workers;
+    std::mutex              _mutex;
+    std::deque<Worker*>     _idleWorkers;
+    std::deque<OnAcquired>  _pendingAcquires;
+};
+
 class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -36,7 +67,8 @@ public:
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 const SubRequestsList &inferRequests,
-                                const std::unordered_map<std::string, std::string>& blobNameMap);
+                                const std::unordered_map<std::string, std::string>& blobNameMap,
+                                const std::vector<SubRequestPool::Ptr>& subRequestPools = {});
 
     void InferImpl() override;
 
@@ -46,8 +78,31 @@ public:
 
     void updateInOutIfNeeded();
 
+    bool isPipelined() const;
+    void bindStageBlobs(const std::size_t stage);
+    void releaseStageWorkers(const std::size_t completedStage, const bool releaseAll);
+    void addBoundaryPerfCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+
+    struct Boundary {
+        std::size_t _byteSize;
+        // the consumer subgraph request is given the producer blob, so HETERO copies nothing,
+        // while the device plugin still may copy the blob to its own memory
+        bool        _sharedBlob;
+    };
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
+    // data passed at every subgraph boundary, filled once in the constructor
+    std::map<std::string, Boundary>                     _boundaries;
+
+    // pipelined execution: subgraph requests are borrowed from the pools for the time of a single inference
+    std::vector<SubRequestPool::Ptr>                                _subRequestPools;
+    std::vector<SubRequestPool::Worker*>                            _workers;
+    std::vector<std::vector<std::size_t>>                           _releaseAfterStage;
+    std::unordered_map<std::string, std::string>                    _subgraphInputToOutputBlobNames;
+    std::unordered_map<std::string, std::size_t>                    _producerStages;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfMap;
+    bool                                                            _needPerfCounters = false;
 };
 
 }  // namespace HeteroPlugin
@@ -11,6 +11,7 @@
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
+#include <auto-batch/auto_batch_config.hpp>
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
@@ -46,6 +47,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -317,6 +321,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                THROW_IE_EXCEPTION
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
         // we need to return a copy of Parameter object which is created on Core side,
@@ -552,6 +565,12 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                deviceNames.push_back(DeviceIDParser(deviceName.substr(pos + 1, deviceName.find_first_of('(') - pos - 1)).getDeviceName());
+            }
+            deviceNames.push_back("BATCH");
         } else {
             deviceNames.push_back(deviceName);
         }
@@ -614,6 +633,9 @@ RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const Para
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote context";
     }
+    if (deviceName.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support remote context";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, params);
     return _impl->GetCPPPluginByName(parsed._deviceName).CreateContext(parsed._config);
@@ -626,6 +648,9 @@ RemoteContext::Ptr Core::GetDefaultContext(const std::string& deviceName) {
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote context";
     }
+    if (deviceName.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support remote context";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, ParamMap());
     return _impl->GetCPPPluginByName(parsed._deviceName).GetDefaultContext(parsed._config);
@@ -640,6 +665,10 @@ void Core::AddExtension(IExtensionPtr extension, const std::string& deviceName_)
         THROW_IE_EXCEPTION
             << "MULTI device does not support extensions. Please, set extensions directly to fallback devices";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION
+            << "BATCH device does not support extensions. Please, set extensions directly to the batched device";
+    }
 
     _impl->AddExtension(extension);
 }
@@ -652,6 +681,9 @@ ExecutableNetwork Core::ImportNetwork(const std::string& modelFileName, const st
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support ImportNetwork";
     }
+    if (deviceName.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support ImportNetwork";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config);
     return _impl->GetCPPPluginByName(parsed._deviceName).ImportNetwork(modelFileName, parsed._config);
@@ -123,8 +123,10 @@ void registerReaders() {
 
     // try to load IR reader v10 if library exists
     auto irReaderv10 = create_if_exists("IRv10", std::string("inference_engine_ir_reader") + std::string(IE_BUILD_POSTFIX));
-    if (irReaderv10)
+    if (irReaderv10) {
         readers.emplace("xml", irReaderv10);
+        readers.emplace("irb", irReaderv10);
+    }
 
     // try to load IR reader v7 if library exists
     auto irReaderv7 = create_if_exists("IRv7", std::string("inference_engine_ir_v7_reader") + std::string(IE_BUILD_POSTFIX));
@@ -25,9 +25,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
     struct ThisRequestExecutor : public ITaskExecutor {
         explicit ThisRequestExecutor(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
-            auto workerInferRequest = _this->_workerInferRequest;
-            workerInferRequest->_task = std::move(task);
-            workerInferRequest->_inferRequest.StartAsync();
+            MultiDeviceExecutableNetwork::StartWorkerInferRequest(_this->_workerInferRequest, std::move(task));
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
     };
@@ -3,7 +3,9 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -48,6 +50,61 @@ struct IdleGuard {
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
 };
 
+struct InFlightGuard {
+    explicit InFlightGuard(MultiDeviceExecutableNetwork::DeviceStatistics& deviceStatistics) :
+        _deviceStatistics{&deviceStatistics} {
+        ++_deviceStatistics->_numInFlight;
+    }
+    ~InFlightGuard() {
+        // the completion callback is never called for the request that failed to start
+        if (nullptr != _deviceStatistics) {
+            --_deviceStatistics->_numInFlight;
+        }
+    }
+    MultiDeviceExecutableNetwork::DeviceStatistics* Release() {
+        auto deviceStatistics = _deviceStatistics;
+        _deviceStatistics = nullptr;
+        return deviceStatistics;
+    }
+    MultiDeviceExecutableNetwork::DeviceStatistics* _deviceStatistics = nullptr;
+};
+
+namespace {
+// weight of the most recent latency sample in the moving average
+constexpr double latencyEwmaAlpha = 0.2;
+}  // namespace
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::OnDispatch() {
+    ++_numDispatched;
+}
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::OnComplete(double latencyMs) {
+    auto latencyEwmaMs = _latencyEwmaMs.load();
+    double newLatencyEwmaMs = 0.0;
+    do {
+        newLatencyEwmaMs = (0.0 == latencyEwmaMs) ? latencyMs
+                                                  : latencyEwmaMs + latencyEwmaAlpha * (latencyMs - latencyEwmaMs);
+    } while (!_latencyEwmaMs.compare_exchange_weak(latencyEwmaMs, newLatencyEwmaMs));
+    --_numInFlight;
+}
+
+double MultiDeviceExecutableNetwork::DeviceStatistics::PredictedCompletionTimeMs() const {
+    // the device that was not measured yet is preferred, so every device gets its latency estimated
+    const auto latencyEwmaMs = _latencyEwmaMs.load();
+    return latencyEwmaMs * (_numInFlight.load() + 1) / std::max<std::size_t>(_numWorkerRequests, 1);
+}
+
+MultiDeviceExecutableNetwork::SchedulingPolicy MultiDeviceExecutableNetwork::ParseSchedulingPolicy(const std::string& policy) {
+    if (policy == MultiDeviceConfigParams::MULTI_PRIORITY_ORDER) {
+        return SchedulingPolicy::PriorityOrder;
+    } else if (policy == MultiDeviceConfigParams::MULTI_LOWEST_COMPLETION_TIME) {
+        return SchedulingPolicy::LowestCompletionTime;
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported value for the " << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY
+                           << " config key: " << policy;
+    }
+}
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
@@ -59,6 +116,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end()) {
+        _schedulingPolicy = ParseSchedulingPolicy(itPolicy->second.as<std::string>());
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -78,17 +139,22 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto* deviceStatisticsPtr = &(_deviceStatistics[device]);
+        deviceStatisticsPtr->_numWorkerRequests = numRequests;
         workerRequests.resize(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
+            workerRequest._deviceStatistics = deviceStatisticsPtr;
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    deviceStatisticsPtr->OnComplete(std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -111,12 +177,26 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (SchedulingPolicy::LowestCompletionTime == _schedulingPolicy) {
+        // the devices are tried in the order of the predicted completion time, the priority order breaks the ties
+        std::vector<std::pair<double, DeviceInformation>> predictedDevices;
+        for (auto&& device : devices) {
+            predictedDevices.emplace_back(_deviceStatistics[device.deviceName].PredictedCompletionTimeMs(), device);
+        }
+        std::stable_sort(predictedDevices.begin(), predictedDevices.end(),
+            [] (const std::pair<double, DeviceInformation>& l, const std::pair<double, DeviceInformation>& r) {
+                return l.first < r.first;
+            });
+        std::transform(predictedDevices.begin(), predictedDevices.end(), devices.begin(),
+            [] (const std::pair<double, DeviceInformation>& predictedDevice) { return predictedDevice.second; });
+    }
     for (auto&& device : devices) {
         WorkerInferRequest* workerRequestPtr = nullptr;
         NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
+            workerRequestPtr->_startTime = std::chrono::steady_clock::now();
             {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
@@ -129,6 +209,14 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
     _inferPipelineTasks.push(std::move(inferPipelineTask));
 }
 
+void MultiDeviceExecutableNetwork::StartWorkerInferRequest(WorkerInferRequest* workerRequestPtr, Task task) {
+    // the request is counted in flight before the start, as the completion callback may be called before StartAsync returns
+    InFlightGuard inFlightGuard{*workerRequestPtr->_deviceStatistics};
+    workerRequestPtr->_task = std::move(task);
+    workerRequestPtr->_inferRequest.StartAsync();
+    inFlightGuard.Release()->OnDispatch();
+}
+
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     ScheduleToWorkerInferRequest(std::move(inferPipelineTask));
 }
@@ -247,10 +335,18 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_DISPATCH_COUNTS)
         });
+    } else if (name == METRIC_KEY(MULTI_DEVICE_DISPATCH_COUNTS)) {
+        std::map<std::string, uint64_t> dispatchCounts;
+        for (auto&& deviceStatistics : _deviceStatistics) {
+            dispatchCounts[deviceStatistics.first] = deviceStatistics.second._numDispatched.load();
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_DISPATCH_COUNTS, dispatchCounts);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -6,12 +6,16 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
 #include <map>
 #include <vector>
 #include <string>
+#include <thread>
 
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include <ie_parallel.hpp>
@@ -46,51 +50,147 @@ public:
     void push(T value) {
         std::lock_guard<std::mutex> lock(_mutex);
         _queue.push(std::move(value));
+        ++_size;
     }
     bool try_pop(T& value) {
+        // every completed worker request polls the queue, so the (usual) empty case does not take the lock
+        if (0 == _size.load()) {
+            return false;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
         if (!_queue.empty()) {
             value = std::move(_queue.front());
             _queue.pop();
+            --_size;
             return true;
         } else {
             return false;
         }
     }
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
+    std::queue<T>               _queue;
+    std::mutex                  _mutex;
+    std::atomic<std::size_t>    _size = {0};
 };
+
+/**
+ * @brief Lock-free bounded multi-producer/multi-consumer queue (D. Vyukov's algorithm).
+ * Every cell carries a sequence number that tells producers and consumers whether the cell is ready for them,
+ * so push and pop are a single CAS on the corresponding position in the uncontended case.
+ * @note set_capacity with non-zero value must be called before the queue is used concurrently,
+ *       while set_capacity(0) may be called at any time to stop accepting and returning the values.
+ *       It waits for the calls in progress, so no value is accepted or returned once it has returned
+ */
 template <typename T>
 class ThreadSafeBoundedQueue {
 public:
     ThreadSafeBoundedQueue() = default;
     bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
+        UseGuard useGuard{_numUsers};
+        if (!_capacity.load()) {
+            return false;
+        }
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto seq = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (0 == diff) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell is still being read by a consumer that has already claimed it, so the queue is not full
+                if (_dequeuePos.load(std::memory_order_relaxed) + _mask >= pos) {
+                    continue;
+                }
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
         }
-        return _capacity;
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
     }
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
+        UseGuard useGuard{_numUsers};
+        if (!_capacity.load()) {
             return false;
         }
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto seq = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell is still being written by a producer that has already claimed it, so the queue is not empty
+                if (_enqueuePos.load(std::memory_order_relaxed) > pos) {
+                    continue;
+                }
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
     }
     void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
+        if (0 != newCapacity) {
+            std::size_t size = 1;
+            while (size < newCapacity) {
+                size <<= 1;
+            }
+            _cells.reset(new Cell[size]);
+            for (std::size_t i = 0; i < size; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+            _mask = size - 1;
+            _enqueuePos.store(0, std::memory_order_relaxed);
+            _dequeuePos.store(0, std::memory_order_relaxed);
+        }
+        _capacity.store(0 != newCapacity);
+        // the calls that have seen the queue open before the store above are completed before returning
+        while (0 == newCapacity && 0 != _numUsers.load()) {
+            std::this_thread::yield();
+        }
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
+    // the users are counted before checking the capacity, so (with sequentially consistent accesses)
+    // either set_capacity(0) waits for the call or the call sees the queue stopped
+    struct UseGuard {
+        explicit UseGuard(std::atomic<std::size_t>& numUsers) : _numUsers(numUsers) {
+            ++_numUsers;
+        }
+        ~UseGuard() {
+            --_numUsers;
+        }
+        std::atomic<std::size_t>& _numUsers;
+    };
+    struct Cell {
+        std::atomic<std::size_t>    _sequence = {0};
+        T                           _value = {};
+    };
+    // positions are padded to separate cache lines to avoid false sharing between producers and consumers
+    static constexpr std::size_t cacheLineSize = 64;
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    std::atomic_bool            _capacity = {false};
+    std::atomic<std::size_t>    _numUsers = {0};
+    char                        _pad0[cacheLineSize];
+    std::atomic<std::size_t>    _enqueuePos = {0};
+    char                        _pad1[cacheLineSize];
+    std::atomic<std::size_t>    _dequeuePos = {0};
+    char                        _pad2[cacheLineSize];
 };
 #endif
 
@@ -98,13 +198,30 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    struct DeviceStatistics {
+        std::atomic<std::uint64_t>  _numDispatched = {0};
+        std::atomic<unsigned int>   _numInFlight = {0};
+        std::atomic<double>         _latencyEwmaMs = {0.0};
+        std::size_t                 _numWorkerRequests = 0;
+
+        void OnDispatch();
+        void OnComplete(double latencyMs);
+        double PredictedCompletionTimeMs() const;
+    };
     struct WorkerInferRequest {
-        InferenceEngine::InferRequest   _inferRequest;
-        InferenceEngine::Task           _task;
-        InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        InferenceEngine::InferRequest           _inferRequest;
+        InferenceEngine::Task                   _task;
+        InferenceEngine::StatusCode             _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point   _startTime;
+        DeviceStatistics*                       _deviceStatistics = nullptr;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
+    enum class SchedulingPolicy {
+        PriorityOrder,
+        LowestCompletionTime
+    };
+
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
                                           const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
@@ -120,6 +237,9 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task);
+    static void StartWorkerInferRequest(WorkerInferRequest* workerRequestPtr, InferenceEngine::Task task);
+
+    static SchedulingPolicy ParseSchedulingPolicy(const std::string& policy);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
@@ -130,6 +250,8 @@ public:
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    SchedulingPolicy                                            _schedulingPolicy = SchedulingPolicy::PriorityOrder;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
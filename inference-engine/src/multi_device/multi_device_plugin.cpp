@@ -108,6 +108,9 @@ Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MultiDeviceConfigParams::MULTI_PRIORITY_ORDER} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -140,6 +143,7 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -169,6 +173,16 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
 
+    auto schedulingPolicy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (schedulingPolicy != fullConfig.end()) {
+        // throws on the unsupported values before any network is loaded to the devices
+        MultiDeviceExecutableNetwork::ParseSchedulingPolicy(schedulingPolicy->second);
+        multiNetworkConfig.insert(*schedulingPolicy);
+    } else {
+        multiNetworkConfig.insert({MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                   std::string{MultiDeviceConfigParams::MULTI_PRIORITY_ORDER}});
+    }
+
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     for (auto& p : metaDevices) {
         auto & deviceName = p.deviceName;
@@ -0,0 +1,486 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_binary_parser.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <transformations/serialize_binary_format.hpp>
+
+#include "ie_ir_itt.hpp"
+#include "ie_ir_parser.hpp"
+
+using namespace InferenceEngine;
+using AttributeKind = ngraph::binary_ir::AttributeKind;
+
+namespace {
+
+/**
+ * Reads values from the model stream and reports truncated models
+ */
+class StreamReader {
+public:
+    explicit StreamReader(std::istream& stream): stream(stream) {}
+
+    void read(char* data, size_t size) {
+        stream.read(data, size);
+        if (static_cast<size_t>(stream.gcount()) != size)
+            THROW_IE_EXCEPTION << "Invalid binary IR! Unexpected end of the model stream.";
+    }
+
+    template <typename T>
+    T read() {
+        T value;
+        read(reinterpret_cast<char*>(&value), sizeof(T));
+        return value;
+    }
+
+    std::string readString() {
+        std::string value(read<uint32_t>(), '\0');
+        if (!value.empty())
+            read(&value[0], value.size());
+        return value;
+    }
+
+private:
+    std::istream& stream;
+};
+
+struct Attribute {
+    std::string name;
+    AttributeKind kind;
+    const char* payload;
+};
+
+/**
+ * Walks over the attributes blob of one node and records where every payload starts
+ */
+class AttributeParser {
+public:
+    explicit AttributeParser(const std::vector<char>& data)
+        : pos(data.data()), end(data.data() + data.size()) {}
+
+    void parse(std::vector<Attribute>& attributes) {
+        attributes.clear();
+        while (pos != end) {
+            Attribute attribute;
+            attribute.name = readString();
+            attribute.kind = read<AttributeKind>();
+            attribute.payload = pos;
+            skipPayload(attribute.kind);
+            attributes.emplace_back(std::move(attribute));
+        }
+    }
+
+private:
+    const char* pos;
+    const char* const end;
+
+    void skip(size_t size) {
+        if (static_cast<size_t>(end - pos) < size)
+            THROW_IE_EXCEPTION << "Invalid binary IR! Attribute exceeds the attributes blob.";
+        pos += size;
+    }
+
+    template <typename T>
+    T read() {
+        const char* data = pos;
+        skip(sizeof(T));
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    std::string readString() {
+        const auto size = read<uint32_t>();
+        const char* data = pos;
+        skip(size);
+        return std::string(data, size);
+    }
+
+    void skipVector(size_t elementSize) {
+        skip(read<uint32_t>() * elementSize);
+    }
+
+    void skipPayload(AttributeKind kind) {
+        switch (kind) {
+        case AttributeKind::Boolean: skip(sizeof(uint8_t)); break;
+        case AttributeKind::Int64: skip(sizeof(int64_t)); break;
+        case AttributeKind::Double: skip(sizeof(double)); break;
+        case AttributeKind::String: readString(); break;
+        case AttributeKind::Data: skip(2 * sizeof(uint64_t)); break;
+        case AttributeKind::VectorInt8: skipVector(sizeof(int8_t)); break;
+        case AttributeKind::VectorInt16: skipVector(sizeof(int16_t)); break;
+        case AttributeKind::VectorInt32: skipVector(sizeof(int32_t)); break;
+        case AttributeKind::VectorInt64: skipVector(sizeof(int64_t)); break;
+        case AttributeKind::VectorUInt8: skipVector(sizeof(uint8_t)); break;
+        case AttributeKind::VectorUInt16: skipVector(sizeof(uint16_t)); break;
+        case AttributeKind::VectorUInt32: skipVector(sizeof(uint32_t)); break;
+        case AttributeKind::VectorUInt64: skipVector(sizeof(uint64_t)); break;
+        case AttributeKind::VectorFloat: skipVector(sizeof(float)); break;
+        case AttributeKind::VectorDouble: skipVector(sizeof(double)); break;
+        case AttributeKind::VectorString: {
+            const auto count = read<uint32_t>();
+            for (uint32_t i = 0; i < count; i++)
+                readString();
+            break;
+        }
+        default:
+            THROW_IE_EXCEPTION << "Invalid binary IR! Unknown attribute kind " << static_cast<int>(kind);
+        }
+    }
+};
+
+template <typename T>
+T readPayload(const char*& payload) {
+    T value;
+    std::memcpy(&value, payload, sizeof(T));
+    payload += sizeof(T);
+    return value;
+}
+
+std::string readPayloadString(const char*& payload) {
+    const auto size = readPayload<uint32_t>(payload);
+    std::string value(payload, size);
+    payload += size;
+    return value;
+}
+
+template <typename T>
+struct VectorKind;
+
+#define VECTOR_KIND(type, kind)                                  \
+    template <>                                                  \
+    struct VectorKind<type> {                                    \
+        static constexpr AttributeKind value = AttributeKind::kind; \
+    }
+
+VECTOR_KIND(int8_t, VectorInt8);
+VECTOR_KIND(int16_t, VectorInt16);
+VECTOR_KIND(int32_t, VectorInt32);
+VECTOR_KIND(int64_t, VectorInt64);
+VECTOR_KIND(uint8_t, VectorUInt8);
+VECTOR_KIND(uint16_t, VectorUInt16);
+VECTOR_KIND(uint32_t, VectorUInt32);
+VECTOR_KIND(uint64_t, VectorUInt64);
+VECTOR_KIND(float, VectorFloat);
+VECTOR_KIND(double, VectorDouble);
+
+#undef VECTOR_KIND
+
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(const std::vector<Attribute>& attributes, const Blob::CPtr& weights)
+        : attributes(attributes), weights(weights) {}
+
+    /**
+     * Looks the attribute up by name, returns nullptr if it was not serialized.
+     * Operations visit attributes in the order they were written, so the search
+     * starts right after the previously found attribute.
+     */
+    const Attribute* find(const std::string& name) {
+        for (size_t i = 0; i < attributes.size(); i++) {
+            const size_t idx = (cursor + i) % attributes.size();
+            if (attributes[idx].name == name) {
+                cursor = idx + 1;
+                return &attributes[idx];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Returns pointer to the weights referenced by the Data attribute after bounds check
+     */
+    char* getData(const Attribute& attribute, size_t& size) {
+        const char* payload = attribute.payload;
+        const auto offset = readPayload<uint64_t>(payload);
+        size = readPayload<uint64_t>(payload);
+
+        const size_t length = weights ? weights->byteSize() : 0;
+        if (!length)
+            THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+        if (offset > length || length - offset < size)
+            THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+        return weights->cbuffer().as<char*>() + offset;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        // such attributes are not written to the binary IR
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        const auto attribute = get(name, AttributeKind::Data);
+        if (!attribute) return;
+        size_t size = 0;
+        const char* data = getData(*attribute, size);
+        if (size != adapter.size())
+            THROW_IE_EXCEPTION << "Attribute " << name << " has size " << size << " while " << adapter.size()
+                               << " bytes are expected!";
+        std::memcpy(adapter.get_ptr(), data, size);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        const auto attribute = get(name, AttributeKind::String);
+        if (!attribute) return;
+        const char* payload = attribute->payload;
+        adapter.set(readPayloadString(payload));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        const auto attribute = get(name, AttributeKind::Boolean);
+        if (!attribute) return;
+        const char* payload = attribute->payload;
+        adapter.set(readPayload<uint8_t>(payload) != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        setInt(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        setReal(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        setReal(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        const auto attribute = get(name, AttributeKind::VectorString);
+        if (!attribute) return;
+        const char* payload = attribute->payload;
+        std::vector<std::string> value(readPayload<uint32_t>(payload));
+        for (auto& item : value)
+            item = readPayloadString(payload);
+        adapter.set(value);
+    }
+
+private:
+    const std::vector<Attribute>& attributes;
+    const Blob::CPtr& weights;
+    size_t cursor = 0;
+
+    const Attribute* get(const std::string& name, AttributeKind kind) {
+        const auto attribute = find(name);
+        if (attribute && attribute->kind != kind)
+            THROW_IE_EXCEPTION << "Attribute " << name << " has unexpected kind " << static_cast<int>(attribute->kind)
+                               << " in binary IR!";
+        return attribute;
+    }
+
+    template <typename T>
+    void setInt(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        const auto attribute = get(name, AttributeKind::Int64);
+        if (!attribute) return;
+        const char* payload = attribute->payload;
+        adapter.set(static_cast<T>(readPayload<int64_t>(payload)));
+    }
+
+    template <typename T>
+    void setReal(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        const auto attribute = get(name, AttributeKind::Double);
+        if (!attribute) return;
+        const char* payload = attribute->payload;
+        adapter.set(static_cast<T>(readPayload<double>(payload)));
+    }
+
+    template <typename T>
+    void setVector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        const auto attribute = get(name, VectorKind<T>::value);
+        if (!attribute) return;
+        const char* payload = attribute->payload;
+        std::vector<T> value(readPayload<uint32_t>(payload));
+        if (!value.empty())
+            std::memcpy(value.data(), payload, value.size() * sizeof(T));
+        adapter.set(value);
+    }
+};
+
+std::shared_ptr<ngraph::Node> createConstant(BinaryDeserializer& visitor, const Blob::CPtr& weights) {
+    ngraph::element::Type type;
+    ngraph::Shape shape;
+    visitor.on_attribute("element_type", type);
+    visitor.on_attribute("shape", shape);
+
+    const auto value = visitor.find("value");
+    if (!value || value->kind != AttributeKind::Data)
+        THROW_IE_EXCEPTION << "No value defined for Constant op!";
+    size_t size = 0;
+    char* data = visitor.getData(*value, size);
+    if (size < std::ceil(ngraph::shape_size(shape) * type.bitwidth() / 8.f))
+        THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for Constant op!";
+
+    // alias the weights instead of copying them, the buffer keeps the blob alive
+    Blob::CPtr holder = weights;
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, holder);
+    return std::make_shared<ngraph::op::Constant>(type, shape, buffer);
+}
+
+std::shared_ptr<ngraph::Node> createNode(const std::map<std::string, ngraph::OpSet>& opsets,
+                                         const std::string& type, const std::string& version,
+                                         const ngraph::OutputVector& inputs,
+                                         const std::vector<Attribute>& attributes,
+                                         const Blob::CPtr& weights) {
+    auto opset = opsets.find(version);
+    if (opset == opsets.end())
+        THROW_IE_EXCEPTION << "Cannot create " << type << " layer from unsupported opset: " << version;
+    if (!opset->second.contains_type(type))
+        THROW_IE_EXCEPTION << "Opset " << version << " doesn't contain the operation with type: " << type;
+
+    BinaryDeserializer visitor(attributes, weights);
+    if (type == "Constant")
+        return createConstant(visitor, weights);
+
+    auto node = std::shared_ptr<ngraph::Node>(opset->second.create(type));
+    node->set_arguments(inputs);
+    if (node->visit_attributes(visitor))
+        node->constructor_validate_and_infer_types();
+    return node;
+}
+
+}  // namespace
+
+BinaryIRParser::BinaryIRParser(const std::vector<IExtensionPtr>& exts) : opsets(loadOpsets(exts)), _exts(exts) {}
+
+CNNNetwork BinaryIRParser::parse(std::istream& model, const Blob::CPtr& weights) {
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "BinaryIRParser", "ReadHeader");
+
+    StreamReader reader(model);
+    char magic[sizeof(ngraph::binary_ir::magic)];
+    reader.read(magic, sizeof(magic));
+    if (std::memcmp(magic, ngraph::binary_ir::magic, sizeof(magic)) != 0)
+        THROW_IE_EXCEPTION << "Invalid binary IR! Model stream has wrong signature.";
+    const auto formatVersion = reader.read<uint32_t>();
+    if (formatVersion != ngraph::binary_ir::format_version)
+        THROW_IE_EXCEPTION << "Unsupported binary IR format version: " << formatVersion;
+    // constants alignment is a hint for writers of mapped weights, nothing depends on it here
+    reader.read<uint32_t>();
+    const auto functionName = reader.readString();
+    const auto nodeCount = reader.read<uint64_t>();
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
+
+    ngraph::ParameterVector parameter_nodes;
+    ngraph::ResultVector result_nodes;
+    ngraph::SinkVector assign_nodes;
+    std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
+    std::unordered_set<std::string> opName;
+
+    // Nodes are stored in topological order, so producers are always created before consumers
+    ngraph::NodeVector nodes;
+    std::vector<char> attributesData;
+    std::vector<Attribute> attributes;
+    for (uint64_t id = 0; id < nodeCount; id++) {
+        const auto type = reader.readString();
+        const auto version = reader.readString();
+        const auto name = reader.readString();
+        if (!opName.insert(name).second)
+            THROW_IE_EXCEPTION << "Invalid IR! " << name << " name is not unique!";
+
+        ngraph::OutputVector inputs(reader.read<uint32_t>());
+        for (size_t i = 0; i < inputs.size(); i++) {
+            const auto producer = reader.read<uint32_t>();
+            const auto port = reader.read<uint32_t>();
+            if (producer >= nodes.size() || port >= nodes[producer]->get_output_size())
+                THROW_IE_EXCEPTION << type << " layer " << name << " with id: " << id
+                                   << " has incorrect input with index " << i << "!";
+            inputs[i] = nodes[producer]->output(port);
+            if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+                THROW_IE_EXCEPTION << type << " layer " << name << " with id: " << id
+                                   << " has undefined element type for input with index " << i << "!";
+        }
+        const auto outputCount = reader.read<uint32_t>();
+
+        attributesData.resize(reader.read<uint32_t>());
+        if (!attributesData.empty())
+            reader.read(attributesData.data(), attributesData.size());
+        AttributeParser(attributesData).parse(attributes);
+
+        auto node = createNode(opsets, type, version, inputs, attributes, weights);
+        node->set_friendly_name(name);
+        if (node->get_output_size() != outputCount)
+            THROW_IE_EXCEPTION << type << " layer " << name << " with id: " << id << " is inconsistent!";
+
+        if (auto parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
+            parameter_nodes.emplace_back(parameter_node);
+        }
+
+        if (auto result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
+            result_nodes.emplace_back(result_node);
+        }
+
+        if (auto assign_node = std::dynamic_pointer_cast<ngraph::op::Assign>(node)) {
+            assign_nodes.emplace_back(assign_node);
+        }
+
+        if (auto read_value_node = std::dynamic_pointer_cast<ngraph::op::ReadValue>(node)) {
+            variable_id_to_read_value[read_value_node->get_variable_id()] = read_value_node;
+        }
+        nodes.emplace_back(node);
+    }
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphFunction");
+
+    auto function = std::make_shared<ngraph::Function>(result_nodes, assign_nodes, parameter_nodes, functionName);
+    for (const auto& assign : assign_nodes) {
+        assign->add_control_dependency(
+            variable_id_to_read_value.at(std::dynamic_pointer_cast<ngraph::op::Assign>(assign)->get_variable_id()));
+    }
+
+    OV_ITT_TASK_NEXT(taskChain, "ConstructCNNNetwork");
+
+    return CNNNetwork(function, _exts);
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#ifdef IR_READER_V10
+
+#include <ie_blob.h>
+#include <cpp/ie_cnn_network.h>
+#include <ie_iextension.h>
+
+#include <ngraph/opsets/opset.hpp>
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Streaming parser of the binary IR v10 variant written by ngraph::pass::Serialize
+ *
+ * Operations are created while the node table is being read, without building any
+ * intermediate document. Constants alias the weights blob instead of being copied,
+ * so the blob is kept alive by the resulting network.
+ */
+class BinaryIRParser {
+public:
+    explicit BinaryIRParser(const std::vector<IExtensionPtr>& exts);
+    CNNNetwork parse(std::istream& model, const Blob::CPtr& weights);
+
+private:
+    std::map<std::string, ngraph::OpSet> opsets;
+    const std::vector<IExtensionPtr> _exts;
+};
+
+}  // namespace InferenceEngine
+
+#endif  // IR_READER_V10
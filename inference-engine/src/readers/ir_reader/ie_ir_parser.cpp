@@ -64,7 +64,8 @@ public:
         originBlob(weights) { }
 };
 
-V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
+std::map<std::string, ngraph::OpSet> InferenceEngine::loadOpsets(const std::vector<IExtensionPtr>& exts) {
+    std::map<std::string, ngraph::OpSet> opsets;
     // Load default opsets
     opsets["opset1"] = ngraph::get_opset1();
     opsets["opset2"] = ngraph::get_opset2();
@@ -81,8 +82,11 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
             opsets[it.first] = it.second;
         }
     }
+    return opsets;
 }
 
+V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : opsets(loadOpsets(exts)), _exts(exts) {}
+
 std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const Blob::CPtr& weights) {
     OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
@@ -52,6 +52,13 @@ public:
 
 #ifdef IR_READER_V10
 
+/**
+ * @brief Collects default nGraph opsets and opsets provided by extensions
+ * @param exts vector with extensions
+ * @return map from opset name to opset
+ */
+std::map<std::string, ngraph::OpSet> loadOpsets(const std::vector<IExtensionPtr>& exts);
+
 class V10Parser : public IParser {
 public:
     explicit V10Parser(const std::vector<IExtensionPtr>& exts);
@@ -15,11 +15,21 @@
 #include "ie_ir_parser.hpp"
 #include "ie_ir_itt.hpp"
 
+#ifdef IR_READER_V10
+# include <transformations/serialize_binary_format.hpp>
+# include "ie_ir_binary_parser.hpp"
+#endif  // IR_READER_V10
+
 using namespace InferenceEngine;
 
 bool IRReader::supportModel(std::istream& model) const {
     OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "IRReader::supportModel");
 
+#ifdef IR_READER_V10
+    if (ngraph::binary_ir::is_binary_ir(model))
+        return true;
+#endif
+
     auto version = details::GetIRVersion(model);
 
 #ifdef IR_READER_V10
@@ -36,6 +46,13 @@ CNNNetwork IRReader::read(std::istream& model, const std::vector<IExtensionPtr>&
 CNNNetwork IRReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
     OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "IRReader::read");
 
+#ifdef IR_READER_V10
+    if (ngraph::binary_ir::is_binary_ir(model)) {
+        BinaryIRParser parser(exts);
+        return parser.parse(model, weights);
+    }
+#endif
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load(model);
     if (res.status != pugi::status_ok) {
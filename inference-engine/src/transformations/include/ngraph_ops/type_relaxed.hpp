@@ -55,6 +55,7 @@ public:
             m_output_data_types.resize(outputIndex + 1, element::undefined);
         }
         m_output_data_types[outputIndex] = element_type;
+        mark_for_revalidation();
     }
 
     /// \return Data type that will be set for input when original shape/type inference function is called.
@@ -77,9 +78,17 @@ public:
             m_input_data_types.resize(inputIndex + 1, element::undefined);
         }
         m_input_data_types[inputIndex] = element_type;
+        mark_for_revalidation();
     }
 
 protected:
+    // The overridden types are used by type inference, so the operation is validated again after they change
+    void mark_for_revalidation() {
+        if (auto node = dynamic_cast<Node*>(this)) {
+            node->set_needs_revalidation();
+        }
+    }
+
     // Data types that are used for parent shape/type infer function input ports
     // to infer output data types
     element::TypeVector m_input_data_types;
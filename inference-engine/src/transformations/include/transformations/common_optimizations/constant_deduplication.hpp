@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ConstantDeduplication;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ConstantDeduplication merges constants with equal element type, shape
+ * and data into one node, so that all consumers share a single buffer.
+ *
+ * Constant buffers are hashed in parallel for large functions, candidates with
+ * equal hash are compared byte by byte before merging. Constants connected to
+ * Result operations are kept as is since their names define network outputs.
+ */
+class ngraph::pass::ConstantDeduplication: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// @brief Returns size of constant buffers released by the last run in bytes
+    size_t get_saved_bytes() const { return m_saved_bytes; }
+
+private:
+    size_t m_saved_bytes = 0;
+};
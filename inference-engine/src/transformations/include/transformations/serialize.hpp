@@ -26,10 +26,13 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - IR_V10_BINARY writes the same operations and attributes as IR_V10 into a
+ * compact binary model file (see serialize_binary_format.hpp) and stores
+ * constants aligned in the bin file; sub-graph operations are not supported
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
-    enum class Version { IR_V10 };
+    enum class Version { IR_V10, IR_V10_BINARY };
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+
+/**
+ * @brief Layout of the binary IR v10 variant produced by
+ * ngraph::pass::Serialize with Version::IR_V10_BINARY
+ *
+ * The model stream is a flat node table, all integers are little-endian:
+ * - header: magic[8], u32 format_version, u32 constants_alignment,
+ *   str function_name, u64 node_count
+ * - node_count node records in topological order:
+ *   str type, str version (opset name), str name,
+ *   u32 input_count, input_count x {u32 producer node, u32 producer output},
+ *   u32 output_count, u32 attributes_size, attributes blob
+ * - attributes blob is a sequence of {str name, u8 AttributeKind, payload}:
+ *   Boolean: u8, Int64: i64, Double: f64, String: str,
+ *   Data: u64 offset, u64 size into the weights file,
+ *   Vector*: u32 count followed by count elements (VectorString: count x str)
+ * - str is u32 length followed by length bytes
+ *
+ * Every Data payload in the weights file starts at a multiple of
+ * constants_alignment so that readers can alias constants in a mapped
+ * file instead of copying them.
+ */
+
+namespace ngraph {
+namespace binary_ir {
+
+constexpr char magic[8] = {'I', 'R', '1', '0', 'B', 'I', 'N', '\0'};
+constexpr uint32_t format_version = 1;
+constexpr uint32_t constants_alignment = 64;
+
+enum class AttributeKind : uint8_t {
+    Boolean,
+    Int64,
+    Double,
+    String,
+    Data,
+    VectorInt8,
+    VectorInt16,
+    VectorInt32,
+    VectorInt64,
+    VectorUInt8,
+    VectorUInt16,
+    VectorUInt32,
+    VectorUInt64,
+    VectorFloat,
+    VectorDouble,
+    VectorString
+};
+
+/**
+ * @brief Checks whether the stream starts with the binary IR magic, the
+ * stream position is restored to the beginning
+ */
+inline bool is_binary_ir(std::istream& model) {
+    char header[sizeof(magic)] = {};
+
+    model.seekg(0, model.beg);
+    model.read(header, sizeof(header));
+    const bool matched = model.gcount() == sizeof(header) &&
+                         std::memcmp(header, magic, sizeof(magic)) == 0;
+    model.clear();
+    model.seekg(0, model.beg);
+    return matched;
+}
+
+}  // namespace binary_ir
+}  // namespace ngraph
@@ -0,0 +1,157 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/constant_deduplication.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/log.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantDeduplication, "ConstantDeduplication", 0);
+
+namespace {
+
+struct ConstantInfo {
+    std::shared_ptr<ngraph::opset1::Constant> node;
+    const char* data;
+    size_t size;
+    size_t hash;
+};
+
+// FNV-1a over 64-bit words, collisions are resolved by comparing the data
+size_t hash_data(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    const uint64_t prime = 1099511628211ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+    }
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+void hash_constants(std::vector<ConstantInfo>& constants) {
+    // hashing small functions in one thread is faster than spawning workers
+    const size_t parallel_threshold = 1 << 20;
+
+    auto hash_range = [&constants](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            constants[i].hash = hash_data(constants[i].data, constants[i].size);
+        }
+    };
+
+    size_t total_size = 0;
+    for (const auto& constant : constants) {
+        total_size += constant.size;
+    }
+    const size_t threads = std::min<size_t>(std::thread::hardware_concurrency(), constants.size());
+    if (total_size < parallel_threshold || threads < 2) {
+        hash_range(0, constants.size());
+        return;
+    }
+
+    // split constants into ranges of roughly equal size in bytes
+    const size_t chunk_size = total_size / threads + 1;
+    std::vector<std::future<void>> futures;
+    size_t begin = 0, accumulated = 0;
+    for (size_t i = 0; i < constants.size(); i++) {
+        accumulated += constants[i].size;
+        if (accumulated >= chunk_size) {
+            futures.emplace_back(std::async(std::launch::async, hash_range, begin, i + 1));
+            begin = i + 1;
+            accumulated = 0;
+        }
+    }
+    hash_range(begin, constants.size());
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+bool is_same_constant(const ConstantInfo& a, const ConstantInfo& b) {
+    return a.hash == b.hash && a.size == b.size &&
+           a.node->get_element_type() == b.node->get_element_type() &&
+           a.node->get_shape() == b.node->get_shape() &&
+           (a.data == b.data || std::memcmp(a.data, b.data, a.size) == 0);
+}
+
+bool feeds_result(const ngraph::Node& node) {
+    for (const auto& input : node.output(0).get_target_inputs()) {
+        if (ngraph::is_type<ngraph::opset1::Result>(input.get_node())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool deduplicate(const std::shared_ptr<ngraph::Function>& f, size_t& saved_bytes) {
+    bool rewritten = false;
+    std::vector<ConstantInfo> constants;
+    for (const auto& node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node)) {
+            if (auto sub_graph = sub_graph_node->get_function()) {
+                rewritten |= deduplicate(sub_graph, saved_bytes);
+            }
+            continue;
+        }
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+        if (!constant || feeds_result(*constant) || !constant->get_data_ptr()) {
+            continue;
+        }
+        const size_t size = (ngraph::shape_size(constant->get_shape()) *
+                             constant->get_element_type().bitwidth() + 7) / 8;
+        constants.push_back({constant, static_cast<const char*>(constant->get_data_ptr()), size, 0});
+    }
+    if (constants.size() < 2) {
+        return rewritten;
+    }
+
+    hash_constants(constants);
+
+    // the first constant of every distinct value in topological order is kept
+    std::unordered_multimap<size_t, size_t> unique_constants;
+    for (size_t i = 0; i < constants.size(); i++) {
+        const auto& candidate = constants[i];
+        auto range = unique_constants.equal_range(candidate.hash);
+        auto found = std::find_if(range.first, range.second, [&](const std::pair<const size_t, size_t>& item) {
+            return is_same_constant(constants[item.second], candidate);
+        });
+        if (found == range.second) {
+            unique_constants.emplace(candidate.hash, i);
+            continue;
+        }
+
+        const auto& kept = constants[found->second];
+        if (kept.data != candidate.data) {
+            saved_bytes += candidate.size;
+        }
+        ngraph::copy_runtime_info({kept.node, candidate.node}, kept.node);
+        candidate.node->output(0).replace(kept.node->output(0));
+        rewritten = true;
+    }
+    return rewritten;
+}
+
+}  // namespace
+
+bool ngraph::pass::ConstantDeduplication::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    m_saved_bytes = 0;
+    const bool rewritten = deduplicate(f, m_saved_bytes);
+    NGRAPH_DEBUG << "ConstantDeduplication released " << m_saved_bytes << " bytes of constant data";
+    return rewritten;
+}
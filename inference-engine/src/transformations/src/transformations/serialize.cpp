@@ -12,6 +12,7 @@
 #include "ngraph/opsets/opset.hpp"
 #include "pugixml.hpp"
 #include "transformations/serialize.hpp"
+#include "transformations/serialize_binary_format.hpp"
 
 using namespace ngraph;
 
@@ -113,6 +114,180 @@ public:
     }
 };
 
+template <typename T>
+void write_value(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::string& out, const std::string& value) {
+    write_value(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+}
+
+class BinaryVisitor : public ngraph::AttributeVisitor {
+    std::string& m_attributes;
+    std::vector<uint8_t>& m_bin;
+
+    void write_header(const std::string& name, binary_ir::AttributeKind kind) {
+        write_string(m_attributes, name);
+        write_value(m_attributes, kind);
+    }
+
+    template <typename T>
+    void write_int(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        write_header(name, binary_ir::AttributeKind::Int64);
+        write_value(m_attributes, static_cast<int64_t>(adapter.get()));
+    }
+
+    template <typename T>
+    void write_real(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        write_header(name, binary_ir::AttributeKind::Double);
+        write_value(m_attributes, static_cast<double>(adapter.get()));
+    }
+
+    template <typename T>
+    void write_vector(const std::string& name, binary_ir::AttributeKind kind,
+                      ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        const auto& values = adapter.get();
+        write_header(name, kind);
+        write_value(m_attributes, static_cast<uint32_t>(values.size()));
+        m_attributes.append(reinterpret_cast<const char*>(values.data()),
+                            values.size() * sizeof(T));
+    }
+
+public:
+    BinaryVisitor(std::string& attributes, std::vector<uint8_t>& bin)
+        : m_attributes(attributes), m_bin(bin) {}
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<void>& adapter) override {
+        // not representable, skipped in the same way as in XmlVisitor
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<void*>& adapter) override {
+        const uint64_t alignment = binary_ir::constants_alignment;
+        const uint64_t offset = (m_bin.size() + alignment - 1) / alignment * alignment;
+        const uint64_t size = adapter.size();
+        const auto data = static_cast<const uint8_t*>(adapter.get_ptr());
+        m_bin.resize(offset);
+        m_bin.insert(end(m_bin), data, data + size);
+
+        write_header(name, binary_ir::AttributeKind::Data);
+        write_value(m_attributes, offset);
+        write_value(m_attributes, size);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<bool>& adapter) override {
+        write_header(name, binary_ir::AttributeKind::Boolean);
+        write_value(m_attributes, static_cast<uint8_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::string>& adapter) override {
+        write_header(name, binary_ir::AttributeKind::String);
+        write_string(m_attributes, adapter.get());
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<int8_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<int16_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<int32_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<int64_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<uint8_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<uint16_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<uint32_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<uint64_t>& adapter) override {
+        write_int(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<float>& adapter) override {
+        write_real(name, adapter);
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<double>& adapter) override {
+        write_real(name, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorInt8, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorInt16, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorInt32, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorInt64, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorUInt8, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorUInt16, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorUInt32, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorUInt64, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorFloat, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        write_vector(name, binary_ir::AttributeKind::VectorDouble, adapter);
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        const auto& values = adapter.get();
+        write_header(name, binary_ir::AttributeKind::VectorString);
+        write_value(m_attributes, static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            write_string(m_attributes, value);
+        }
+    }
+};
+
 void visit_exec_graph_node(pugi::xml_node& data, std::string& node_type_name,
                            const ngraph::Node* n) {
     for (const auto& param : n->get_rt_info()) {
@@ -475,6 +650,75 @@ void ngfunction_2_irv10(
     }
 }
 
+void ngfunction_2_irv10_binary(
+    std::string& model, std::vector<uint8_t>& bin,
+    const ngraph::Function& f,
+    const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    NGRAPH_CHECK(!is_exec_graph(f),
+                 "Execution graph can not be serialized to binary IR");
+
+    // parameters, results and sinks keep their order in the function so that
+    // the reader rebuilds the same interface, all of them can be moved to the
+    // ends of the table without breaking the topological order
+    ngraph::NodeVector ordered_ops(f.get_parameters().begin(),
+                                   f.get_parameters().end());
+    for (const auto& node : f.get_ordered_ops()) {
+        if (!ngraph::op::is_parameter(node) && !ngraph::op::is_output(node) &&
+            !std::dynamic_pointer_cast<ngraph::op::Sink>(node)) {
+            ordered_ops.push_back(node);
+        }
+    }
+    ordered_ops.insert(end(ordered_ops), f.get_results().begin(),
+                       f.get_results().end());
+    ordered_ops.insert(end(ordered_ops), f.get_sinks().begin(),
+                       f.get_sinks().end());
+
+    std::unordered_map<ngraph::Node*, uint32_t> node_ids;
+    std::unordered_set<std::string> unique_names;
+
+    model.append(binary_ir::magic, sizeof(binary_ir::magic));
+    write_value(model, binary_ir::format_version);
+    write_value(model, binary_ir::constants_alignment);
+    write_string(model, f.get_friendly_name());
+    write_value(model, static_cast<uint64_t>(ordered_ops.size()));
+
+    std::string attributes;
+    for (const auto& n : ordered_ops) {
+        ngraph::Node* node = n.get();
+        const std::string opset_name = get_opset_name(node, custom_opsets);
+        NGRAPH_CHECK(opset_name != "experimental",
+                     "Unsupported operation for binary IR ", node);
+        NGRAPH_CHECK(!dynamic_cast<ngraph::op::util::SubGraphOp*>(node),
+                     "Sub-graph operations are not supported in binary IR ",
+                     node);
+
+        write_string(model, node->get_type_name());
+        write_string(model, opset_name);
+        write_string(model, get_node_unique_name(unique_names, node));
+
+        write_value(model, static_cast<uint32_t>(node->get_input_size()));
+        for (const auto& i : node->inputs()) {
+            auto source_output = i.get_source_output();
+            auto producer = node_ids.find(source_output.get_node());
+            NGRAPH_CHECK(producer != node_ids.end(), "Internal error");
+            write_value(model, producer->second);
+            write_value(model,
+                        static_cast<uint32_t>(source_output.get_index()));
+        }
+        write_value(model, static_cast<uint32_t>(node->get_output_size()));
+
+        attributes.clear();
+        BinaryVisitor visitor(attributes, bin);
+        NGRAPH_CHECK(node->visit_attributes(visitor),
+                     "Visitor API is not supported in ", node);
+        write_value(model, static_cast<uint32_t>(attributes.size()));
+        model.append(attributes);
+
+        const auto id = static_cast<uint32_t>(node_ids.size());
+        node_ids.emplace(node, id);
+    }
+}
+
 }  // namespace
 
 // ! [function_pass:serialize_cpp]
@@ -482,19 +726,28 @@ void ngfunction_2_irv10(
 bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     // prepare data
     pugi::xml_document xml_doc;
+    std::string binary_model;
     std::vector<uint8_t> constants;
     switch (m_version) {
     case Version::IR_V10:
         ngfunction_2_irv10(xml_doc, constants, *f, m_custom_opsets);
         break;
+    case Version::IR_V10_BINARY:
+        ngfunction_2_irv10_binary(binary_model, constants, *f, m_custom_opsets);
+        break;
     default:
         NGRAPH_UNREACHABLE("Unsupported version");
         break;
     }
 
-    // create xml file
-    std::ofstream xml_file(m_xmlPath, std::ios::out);
-    xml_doc.save(xml_file);
+    // create model file
+    if (m_version == Version::IR_V10_BINARY) {
+        std::ofstream model_file(m_xmlPath, std::ios::out | std::ios::binary);
+        model_file.write(binary_model.data(), binary_model.size());
+    } else {
+        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        xml_doc.save(xml_file);
+    }
 
     // create bin file
     std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
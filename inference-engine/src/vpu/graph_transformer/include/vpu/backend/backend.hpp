@@ -32,6 +32,11 @@ public:
             const Model& model,
             const std::string& postfix = std::string());
 
+    /**
+     * Estimates latency and DDR traffic of the allocated model from the stages metadata
+     */
+    PerformanceEstimate estimatePerformance(const Model& model);
+
 private:
     void serialize(
             const Model& model,
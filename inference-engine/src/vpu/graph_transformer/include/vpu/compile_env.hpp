@@ -55,6 +55,22 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    //
+    // Environment is thread local, worker threads of the parallel passes share
+    // the environment of the compiling thread for the lifetime of this object.
+    //
+    class WorkerScope final {
+    public:
+        explicit WorkerScope(const CompileEnv& env);
+        ~WorkerScope();
+
+        WorkerScope(const WorkerScope&) = delete;
+        WorkerScope& operator=(const WorkerScope&) = delete;
+
+    private:
+        const CompileEnv* _prevEnv = nullptr;
+    };
+
 private:
     explicit CompileEnv(Platform platform);
 };
@@ -112,6 +112,8 @@ struct CompilationConfig final {
     bool forcePureTensorIterator = false;
     bool enableMemoryTypesAnnotation = false;
     bool enableWeightsAnalysis = true;
+    bool enableBssIntervalPacking = false;
+    bool hwConvTilingDmaCost = false;
 
     //
     // Deprecated options
@@ -132,6 +134,51 @@ struct DataInfo final {
     int totalSize = 0;
 };
 
+//
+// PassStatistics
+//
+
+struct PassStatistics final {
+    std::string name;
+
+    double durationMs = 0.0;
+
+    int numStages = 0;
+    int numDatas = 0;
+
+    // Change of the process resident memory over the pass, 0 where it can't be measured
+    std::int64_t memoryDeltaBytes = 0;
+};
+
+//
+// PerformanceEstimate
+//
+
+struct StagePerformanceEstimate final {
+    std::string name;
+    std::string type;
+
+    int numSHAVEs = 0;
+
+    double computeUs = 0.0;
+    double dmaUs = 0.0;
+    double latencyUs = 0.0;
+
+    // Bytes the stage reads and writes outside of CMX
+    std::int64_t ddrBytes = 0;
+};
+
+// Host side estimation of the device execution, used to compare compile options without a device
+struct PerformanceEstimate final {
+    std::vector<StagePerformanceEstimate> stages;
+
+    double latencyUs = 0.0;
+    double throughputFps = 0.0;
+
+    std::int64_t ddrBytes = 0;
+    double ddrBandwidthGBs = 0.0;
+};
+
 //
 // CompiledGraph
 //
@@ -158,6 +205,9 @@ struct CompiledGraph final {
     std::uint32_t numShaves = 0;
     std::uint32_t numSlices = 0;
     std::uint32_t numExecutors = 0;
+
+    std::vector<PassStatistics> passStatistics;
+    PerformanceEstimate performanceEstimate;
 };
 
 //
@@ -98,6 +98,12 @@ public:
 
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
+    /**
+     * Places BSS datas of the last allocation by interval packing of their lifetimes.
+     * Keeps the greedy placement if packing doesn't reduce the BSS size
+     */
+    void packBSSData();
+
 private:
     allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
     void freeMem(allocator::MemChunk* chunk);
@@ -110,6 +116,9 @@ private:
     std::size_t freeDDRMemoryAmount() const;
     std::size_t freeCMXMemoryAmount() const;
 
+    void startLifetime(const Data& data, const allocator::MemChunk* chunk);
+    void finishLifetime(const Data& data);
+
 private:
     int _modelBatchSize = 1;
 
@@ -136,6 +145,10 @@ private:
     bool _needToAllocNonIntermData = true;
 
     DataSet _candidatesForCMX;
+
+    int _allocationTime = 0;
+    std::vector<allocator::ChunkLifetime> _chunkLifetimes;
+    DataMap<std::size_t> _lifetimePerData;
 };
 
 int calcAllocationSize(const Data& data);
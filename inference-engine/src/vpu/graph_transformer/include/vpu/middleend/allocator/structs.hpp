@@ -44,6 +44,18 @@ struct FreeMemory final {
     int size = 0;
 };
 
+//
+// Allocation and release moments of a chunk, measured in allocator events
+//
+
+struct ChunkLifetime final {
+    Data data;
+    MemoryType memType = MemoryType::DDR;
+    int size = 0;
+    int allocTime = 0;
+    int freeTime = -1;
+};
+
 struct MemoryPool final {
     int curMemOffset = 0;
     int memUsed = 0;
@@ -49,12 +49,25 @@ public:
               _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool) {}
 };
 
+// Analytic cost of a tiling, in the units of the HW descriptors cost
+struct TilingCost final {
+    // HW descriptors cost of all the tiles
+    double hwOps = 0.0;
+    // DMA traffic above the single read of input and weights and the single write of output:
+    // copies of misaligned tiles, SoC partial sums and, with MYRIAD_HW_CONV_TILING_DMA_COST,
+    // overlapping input tiles and weights reloads
+    double dmaBytes = 0.0;
+
+    double total() const;
+};
+
 struct TilingOption final {
     int numWidthTiles;
     int numHeightTiles;
     int numChannelTiles;
     int totalNumTiles;
     double cost;
+    TilingCost costTerms;
 };
 
 bool operator<(const TilingOption& lhs, const TilingOption& rhs);
@@ -140,7 +153,8 @@ public:
         _convolutionOptions(other._convolutionOptions),
         _maxTilingOptions(other._maxTilingOptions),
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
-        _tilingOptions(other._tilingOptions) {}
+        _tilingOptions(other._tilingOptions),
+        _tilingOptionsFromCache(other._tilingOptionsFromCache) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
                                 std::size_t maxTilingOptions) :
         _convolutionOptions(std::move(convolutionOptions)),
@@ -148,24 +162,31 @@ public:
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = searchTilingOptions();
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
         return _tilingOptions;
     }
 
+    // options were found by an earlier search for the same shape
+    bool tilingOptionsFromCache() const {
+        return _tilingOptionsFromCache;
+    }
+
     const ConvolutionOptions& convolutionOptions() const { return _convolutionOptions; }
 
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
 private:
+    std::vector<TilingOption> searchTilingOptions();
     std::vector<TilingOption> selectBetterTiling() const;
 
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
     const std::unique_ptr<GraphDataTiling> _dirTiling;
     std::vector<TilingOption> _tilingOptions;
+    bool _tilingOptionsFromCache = false;
 };
 
 // Search for tiling options and applies them to prepare hw tilings
@@ -184,6 +205,14 @@ public:
         return _convolutionOptions._withPool;
     }
 
+    const std::vector<TilingOption>& tilingOptions() const {
+        return _searcher.tilingOptions();
+    }
+
+    bool tilingOptionsFromCache() const {
+        return _searcher.tilingOptionsFromCache();
+    }
+
     const std::vector<HwConvTilingPtr>& getHwTilings() const {
         return _hwTilings;
     }
@@ -197,6 +226,9 @@ private:
     const HWConvolutionTilingSearcher _searcher;
 };
 
+// Drops the tiling options shared between compilations, used by the tests
+void resetTilingOptionsCache();
+
 SmallVector<HwPlaneTileInfo> calcHeightTiles(const ConvolutionOptions& convolutionOptions,
                                              const DimValues& outputTileDims, bool useCeil);
 SmallVector<HwPlaneTileInfo> calcWidthTiles(const ConvolutionOptions& convolutionOptions,
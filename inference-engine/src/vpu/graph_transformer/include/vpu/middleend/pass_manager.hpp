@@ -54,7 +54,7 @@ class PassSet final {
 public:
     using Ptr = std::shared_ptr<PassSet>;
 
-    void run(const Model& model) const;
+    std::vector<PassStatistics> run(const Model& model) const;
 
     inline void addPass(
             const Pass::Ptr& pass,
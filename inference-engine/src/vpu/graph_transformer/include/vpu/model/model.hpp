@@ -352,10 +352,6 @@ private:
             const DimValues& offset,
             SharedConnectionMode connectionMode = SharedConnectionMode::SINGLE_STAGE);
 
-    void runDFS(
-            const Stage& stage,
-            StageMap<bool>& visitedMap) const;
-
 private:
     DataPtrList _dataPtrList;
     StagePtrList _stagePtrList;
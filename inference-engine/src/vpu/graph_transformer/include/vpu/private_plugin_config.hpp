@@ -44,6 +44,18 @@ DECLARE_VPU_CONFIG(MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION);
  */
 DECLARE_VPU_CONFIG(MYRIAD_ENABLE_WEIGHTS_ANALYSIS);
 
+/**
+ * @brief Used to place intermediate DDR (BSS) data by interval packing of their lifetimes
+ * instead of keeping offsets of the greedy per-stage allocation. Is meant for offline compilation. Default = "NO"
+ */
+DECLARE_VPU_CONFIG(MYRIAD_ENABLE_BSS_INTERVAL_PACKING);
+
+/**
+ * @brief Used to rank HW convolution tilings by the DMA traffic of overlapping input tiles and
+ * weights reloads of plane tiles in addition to the descriptors cost. Default = "NO"
+ */
+DECLARE_VPU_CONFIG(MYRIAD_HW_CONV_TILING_DMA_COST);
+
 //
 // Debug options
 //
@@ -66,6 +66,8 @@ CompiledGraph::Ptr BackEnd::build(
     serialize(model, compiledGraph->blob, compiledGraph->blobHeader, compiledGraph->numActiveStages);
     getMetaData(model, allLayers, compiledGraph->graphMeta);
 
+    compiledGraph->performanceEstimate = estimatePerformance(model);
+
     return compiledGraph;
 }
 
@@ -0,0 +1,150 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/backend/backend.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <vpu/compile_env.hpp>
+#include <vpu/middleend/hw/utility.hpp>
+#include <vpu/utils/profiling.hpp>
+
+namespace vpu {
+
+namespace {
+
+//
+// Nominal Myriad X figures, the estimation is meant to compare compile options
+// against each other rather than to predict the absolute device timings
+//
+
+constexpr double VPU_FREQUENCY_MHZ = 700.0;
+constexpr double HW_MACS_PER_CYCLE = 256.0;
+constexpr double SHAVE_OPS_PER_CYCLE = 8.0;
+constexpr double DDR_BYTES_PER_US = 12800.0;
+constexpr double STAGE_DISPATCH_US = 5.0;
+
+bool isDdrLocation(Location location) {
+    return location != Location::CMX && location != Location::None;
+}
+
+std::int64_t stageDdrBytes(const Stage& stage) {
+    std::int64_t bytes = 0;
+
+    const auto addData = [&bytes](const Data& data) {
+        if (data->usage() != DataUsage::Fake && isDdrLocation(data->dataLocation().location)) {
+            bytes += data->totalByteSize();
+        }
+    };
+
+    for (const auto& input : stage->inputs()) {
+        addData(input);
+    }
+    for (const auto& output : stage->outputs()) {
+        addData(output);
+    }
+
+    return bytes;
+}
+
+double stageElements(const Stage& stage) {
+    double elements = 0.0;
+
+    const auto addData = [&elements](const Data& data) {
+        if (data->usage() != DataUsage::Fake && data->usage() != DataUsage::Const) {
+            elements += data->desc().totalDimSize();
+        }
+    };
+
+    for (const auto& input : stage->inputs()) {
+        addData(input);
+    }
+    for (const auto& output : stage->outputs()) {
+        addData(output);
+    }
+    for (const auto& tempBuffer : stage->tempBuffers()) {
+        addData(tempBuffer);
+    }
+
+    return elements;
+}
+
+// Each weight is applied once per output spatial position
+double stageMACs(const Stage& stage) {
+    const auto& outputDesc = stage->output(0)->desc();
+    auto numPositions = static_cast<double>(outputDesc.totalDimSize()) / std::max(outputDesc.dim(Dim::C, 1), 1);
+
+    if (stage->attrs().getOrDefault<HwOpType>("hwOpType", HwOpType::CONV) == HwOpType::CONV_POOL) {
+        numPositions *= stage->attrs().get<int>("poolKernelSizeX") * stage->attrs().get<int>("poolKernelSizeY");
+    }
+
+    double weights = 0.0;
+    for (const auto& input : stage->inputs()) {
+        if (input->usage() == DataUsage::Const) {
+            weights += input->desc().totalDimSize();
+        }
+    }
+
+    return weights * numPositions;
+}
+
+}  // namespace
+
+PerformanceEstimate BackEnd::estimatePerformance(const Model& model) {
+    VPU_PROFILE(estimatePerformance);
+
+    const auto& env = CompileEnv::get();
+
+    env.log->info("Estimate performance of model %s", model->name());
+    VPU_LOGGER_SECTION(env.log);
+
+    PerformanceEstimate estimate;
+
+    for (const auto& stage : model->getStages()) {
+        if (stage->category() == StageCategory::Special) {
+            continue;
+        }
+
+        StagePerformanceEstimate stageEstimate;
+        stageEstimate.name = stage->name();
+        stageEstimate.type = toString(stage->type());
+        stageEstimate.numSHAVEs = stage->numSHAVEs();
+        stageEstimate.ddrBytes = stageDdrBytes(stage);
+
+        if (stage->category() == StageCategory::HW) {
+            const auto work = std::max(stageMACs(stage), stageElements(stage));
+            stageEstimate.computeUs = work / (HW_MACS_PER_CYCLE * VPU_FREQUENCY_MHZ);
+        } else if (stage->category() == StageCategory::SHAVE) {
+            const auto numSHAVEs = std::max(stage->numSHAVEs(), 1);
+            stageEstimate.computeUs = stageElements(stage) / (numSHAVEs * SHAVE_OPS_PER_CYCLE * VPU_FREQUENCY_MHZ);
+        }
+
+        // DMA transfers overlap with the computations of the stage
+        stageEstimate.dmaUs = static_cast<double>(stageEstimate.ddrBytes) / DDR_BYTES_PER_US;
+        stageEstimate.latencyUs = STAGE_DISPATCH_US + std::max(stageEstimate.computeUs, stageEstimate.dmaUs);
+
+        env.log->debug("Stage [%s] : %s, compute %s us, DMA %s us, DDR %s bytes",
+            stageEstimate.name, stageEstimate.type, stageEstimate.computeUs, stageEstimate.dmaUs, stageEstimate.ddrBytes);
+
+        estimate.latencyUs += stageEstimate.latencyUs;
+        estimate.ddrBytes += stageEstimate.ddrBytes;
+        estimate.stages.push_back(std::move(stageEstimate));
+    }
+
+    if (estimate.latencyUs > 0.0) {
+        const auto& resources = model->attrs().get<Resources>("resources");
+
+        // Executors run independent inference requests on their own SHAVEs and CMX slices
+        estimate.throughputFps = resources.numExecutors * 1e6 / estimate.latencyUs;
+        estimate.ddrBandwidthGBs = static_cast<double>(estimate.ddrBytes) / estimate.latencyUs / 1000.0;
+    }
+
+    env.log->info("Estimated latency %s us, throughput %s FPS, DDR traffic %s bytes (%s GB/s)",
+        estimate.latencyUs, estimate.throughputFps, estimate.ddrBytes, estimate.ddrBandwidthGBs);
+
+    return estimate;
+}
+
+}  // namespace vpu
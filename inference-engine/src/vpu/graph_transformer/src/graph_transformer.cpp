@@ -70,6 +70,16 @@ const CompileEnv* CompileEnv::getOrNull() {
     return g_compileEnv;
 }
 
+CompileEnv::WorkerScope::WorkerScope(const CompileEnv& env) : _prevEnv(g_compileEnv) {
+    IE_ASSERT(env.initialized);
+
+    g_compileEnv = const_cast<CompileEnv*>(&env);
+}
+
+CompileEnv::WorkerScope::~WorkerScope() {
+    g_compileEnv = const_cast<CompileEnv*>(_prevEnv);
+}
+
 void CompileEnv::init(Platform platform, const CompilationConfig& config, const Logger::Ptr& log) {
     g_compileEnv = new CompileEnv(platform);
     g_compileEnv->config = config;
@@ -163,7 +173,7 @@ CompiledGraph::Ptr compileImpl(const ie::ICNNNetwork& network, const ie::ICore*
         backEnd->dumpModel(model);
     });
 
-    middleEnd->run(model);
+    auto passStatistics = middleEnd->run(model);
 
     if (!env.config.irWithVpuScalesDir.empty()) {
         network.serialize(env.config.irWithVpuScalesDir + "/" + network.getName() + "_scales.xml",
@@ -171,7 +181,10 @@ CompiledGraph::Ptr compileImpl(const ie::ICNNNetwork& network, const ie::ICore*
                           nullptr);
     }
 
-    return backEnd->build(model, frontEnd->origLayers());
+    auto compiledGraph = backEnd->build(model, frontEnd->origLayers());
+    compiledGraph->passStatistics = std::move(passStatistics);
+
+    return compiledGraph;
 }
 
 CompiledGraph::Ptr compileImpl(const Model& model) {
@@ -185,9 +198,12 @@ CompiledGraph::Ptr compileImpl(const Model& model) {
         backEnd->dumpModel(model);
     });
 
-    middleEnd->run(model);
+    auto passStatistics = middleEnd->run(model);
+
+    auto compiledGraph = backEnd->build(model, {});
+    compiledGraph->passStatistics = std::move(passStatistics);
 
-    return backEnd->build(model, {});
+    return compiledGraph;
 }
 
 }  // namespace
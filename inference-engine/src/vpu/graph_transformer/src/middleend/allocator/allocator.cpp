@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <limits>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/model/model.hpp>
@@ -293,6 +295,8 @@ bool Allocator::allocateData(const Data& data) {
     _memChunksPerData.emplace(data, chunk);
     _allocatedIntermData.emplace(data);
 
+    startLifetime(data, chunk);
+
     return chunk->memType == memoryType;
 }
 
@@ -362,6 +366,7 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
 
         if (chunk->inUse == 0) {
             freeMem(chunk);
+            finishLifetime(parent);
 
             _memChunksPerData.erase(parent);
             _allocatedIntermData.erase(parent);
@@ -418,6 +423,11 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
 
             _memChunksPerData[data] = ddrChunk;
 
+            // The producer already writes the data to the new location
+            auto lifetimeIt = _lifetimePerData.find(data);
+            IE_ASSERT(lifetimeIt != _lifetimePerData.end());
+            _chunkLifetimes[lifetimeIt->second].memType = MemoryType::DDR;
+
             data->setDataAllocationInfo({Location::BSS, ddrChunk->pointer});
             updateChildDataAllocation(data, DDR_MAX_SIZE);
 
@@ -678,6 +688,10 @@ void Allocator::reset() {
     _allocatedIntermData.clear();
 
     _memChunksPerData.clear();
+
+    _allocationTime = 0;
+    _chunkLifetimes.clear();
+    _lifetimePerData.clear();
 }
 
 AllocationResult Allocator::preprocess(const Model& model) {
@@ -713,6 +727,168 @@ AllocationResult Allocator::preprocess(const Model& model) {
     return AllocationResult();
 }
 
+//
+// Chunk lifetimes
+//
+
+void Allocator::startLifetime(const Data& data, const allocator::MemChunk* chunk) {
+    const auto time = _allocationTime++;
+
+    auto it = _lifetimePerData.find(data);
+    if (it != _lifetimePerData.end()) {
+        // Data allocated again keeps a single placement over the whole span
+        auto& lifetime = _chunkLifetimes[it->second];
+        lifetime.size = std::max(lifetime.size, chunk->size);
+        lifetime.freeTime = -1;
+        return;
+    }
+
+    allocator::ChunkLifetime lifetime;
+    lifetime.data = data;
+    lifetime.memType = chunk->memType;
+    lifetime.size = chunk->size;
+    lifetime.allocTime = time;
+
+    _lifetimePerData.emplace(data, _chunkLifetimes.size());
+    _chunkLifetimes.emplace_back(std::move(lifetime));
+}
+
+void Allocator::finishLifetime(const Data& data) {
+    auto it = _lifetimePerData.find(data);
+    IE_ASSERT(it != _lifetimePerData.end());
+
+    _chunkLifetimes[it->second].freeTime = _allocationTime++;
+}
+
+namespace {
+
+struct IntervalBox final {
+    int start = 0;
+    int finish = 0;
+    int size = 0;
+    int offset = 0;
+};
+
+//
+// Places boxes in the given order, each one at the lowest offset which is not occupied
+// by the boxes placed before it and living at the same time. Returns the total size.
+//
+
+int packIntervals(std::vector<IntervalBox>& boxes, const std::vector<std::size_t>& order) {
+    std::vector<std::size_t> placed;
+    placed.reserve(order.size());
+
+    std::vector<std::pair<int, int>> occupied;
+
+    int totalSize = 0;
+    for (const auto ind : order) {
+        auto& box = boxes[ind];
+
+        occupied.clear();
+        for (const auto placedInd : placed) {
+            const auto& other = boxes[placedInd];
+            if (other.start <= box.finish && box.start <= other.finish) {
+                occupied.emplace_back(other.offset, other.offset + other.size);
+            }
+        }
+        std::sort(occupied.begin(), occupied.end());
+
+        int offset = 0;
+        for (const auto& range : occupied) {
+            if (range.first >= offset + box.size) {
+                break;
+            }
+            offset = std::max(offset, range.second);
+        }
+
+        box.offset = offset;
+        totalSize = std::max(totalSize, offset + box.size);
+
+        placed.push_back(ind);
+    }
+
+    return totalSize;
+}
+
+}  // namespace
+
+void Allocator::packBSSData() {
+    std::vector<IntervalBox> boxes;
+    DataVector boxDatas;
+
+    for (const auto& lifetime : _chunkLifetimes) {
+        if (lifetime.memType != MemoryType::DDR) {
+            continue;
+        }
+
+        IntervalBox box;
+        box.start = lifetime.allocTime;
+        // chunks which are not released live till the end of the network
+        box.finish = lifetime.freeTime < 0 ? _allocationTime : lifetime.freeTime;
+        box.size = lifetime.size;
+
+        boxes.push_back(box);
+        boxDatas.push_back(lifetime.data);
+    }
+
+    if (boxes.empty()) {
+        return;
+    }
+
+    //
+    // No single order is the best for all networks, so try several and take the smallest result:
+    //   * allocation order - first fit over the execution of the network
+    //   * biggest chunks first
+    //   * biggest chunks by size and lifetime first
+    //
+
+    std::vector<std::size_t> allocationOrder(boxes.size());
+    for (std::size_t ind = 0; ind < boxes.size(); ++ind) {
+        allocationOrder[ind] = ind;
+    }
+
+    auto sizeOrder = allocationOrder;
+    std::stable_sort(sizeOrder.begin(), sizeOrder.end(), [&boxes](std::size_t left, std::size_t right) {
+        return boxes[left].size > boxes[right].size;
+    });
+
+    const auto area = [&boxes](std::size_t ind) {
+        const auto& box = boxes[ind];
+        return static_cast<std::int64_t>(box.size) * (box.finish - box.start + 1);
+    };
+    auto areaOrder = allocationOrder;
+    std::stable_sort(areaOrder.begin(), areaOrder.end(), [&area](std::size_t left, std::size_t right) {
+        return area(left) > area(right);
+    });
+
+    auto bestSize = _ddrMemoryPool.memUsed;
+    std::vector<int> bestOffsets;
+
+    for (const auto order : {&allocationOrder, &sizeOrder, &areaOrder}) {
+        const auto totalSize = packIntervals(boxes, *order);
+        if (totalSize < bestSize) {
+            bestSize = totalSize;
+            bestOffsets.resize(boxes.size());
+            for (std::size_t ind = 0; ind < boxes.size(); ++ind) {
+                bestOffsets[ind] = boxes[ind].offset;
+            }
+        }
+    }
+
+    if (bestOffsets.empty()) {
+        return;
+    }
+
+    for (std::size_t ind = 0; ind < boxDatas.size(); ++ind) {
+        const auto& data = boxDatas[ind];
+
+        data->setDataAllocationInfo({Location::BSS, bestOffsets[ind]});
+        updateChildDataAllocation(data, DDR_MAX_SIZE);
+    }
+
+    _ddrMemoryPool.memUsed = bestSize;
+}
+
 bool Allocator::removeCMXCandidates(const vpu::Data& data) {
     auto it = _candidatesForCMX.find(data);
 
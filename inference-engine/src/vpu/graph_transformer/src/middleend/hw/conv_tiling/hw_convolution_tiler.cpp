@@ -7,12 +7,83 @@
 #include <vector>
 #include <memory>
 #include <utility>
+#include <map>
+#include <mutex>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 
 namespace vpu {
 
 namespace HWTilingNS {
 
+namespace {
+
+//
+// Tiling options depend only on the convolution shape, the search direction, the CMX limit and the cost model,
+// so they are shared between stages of the same shape and between compilations
+//
+
+class TilingOptionsCache final {
+public:
+    using Key = std::vector<int>;
+
+    bool find(const Key& key, std::vector<TilingOption>& options) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const auto it = _options.find(key);
+        if (it == _options.end()) {
+            return false;
+        }
+
+        options = it->second;
+        return true;
+    }
+
+    void store(const Key& key, const std::vector<TilingOption>& options) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_options.size() >= MAX_SIZE) {
+            _options.clear();
+        }
+
+        _options.emplace(key, options);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _options.clear();
+    }
+
+private:
+    static const std::size_t MAX_SIZE = 4096;
+
+    std::mutex _mutex;
+    std::map<Key, std::vector<TilingOption>> _options;
+};
+
+TilingOptionsCache& tilingOptionsCache() {
+    static TilingOptionsCache cache;
+    return cache;
+}
+
+void appendDims(std::vector<int>& key, const DimValues& dims) {
+    key.push_back(static_cast<int>(dims.size()));
+    for (const auto& dim : dims) {
+        key.push_back(static_cast<int>(dim.first));
+        key.push_back(dim.second);
+    }
+}
+
+}  // namespace
+
+void resetTilingOptionsCache() {
+    tilingOptionsCache().clear();
+}
+
+double TilingCost::total() const {
+    // DMA penalties are counted per moved fp16 element, as the realignment and SoC penalties always were
+    return hwOps + dmaBytes / sizeof(fp16_t);
+}
+
 bool operator<(const TilingOption& lhs, const TilingOption& rhs) {
     return lhs.cost < rhs.cost || (isDoubleEqual(lhs.cost, rhs.cost) && lhs.totalNumTiles < rhs.totalNumTiles);
 }
@@ -617,6 +688,40 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
+std::vector<TilingOption> HWConvolutionTilingSearcher::searchTilingOptions() {
+    const auto& env = CompileEnv::get();
+
+    TilingOptionsCache::Key key;
+    appendDims(key, _convolutionOptions._inputDims);
+    appendDims(key, _convolutionOptions._outputDims);
+    appendDims(key, _convolutionOptions._origOutputDims);
+    key.insert(key.end(), {
+        _convolutionOptions._kernelSizeX,
+        _convolutionOptions._kernelSizeY,
+        _convolutionOptions._kernelStride,
+        _convolutionOptions._paddingLeft,
+        _convolutionOptions._paddingRight,
+        _convolutionOptions._paddingTop,
+        _convolutionOptions._paddingBottom,
+        _convolutionOptions._withPool ? 1 : 0,
+        static_cast<int>(_dirTiling->getDirection()),
+        static_cast<int>(_maxTilingOptions),
+        env.resources.tilingCMXLimit,
+        env.config.hwConvTilingDmaCost ? 1 : 0
+    });
+
+    std::vector<TilingOption> options;
+    _tilingOptionsFromCache = tilingOptionsCache().find(key, options);
+    if (_tilingOptionsFromCache) {
+        return options;
+    }
+
+    options = selectBetterTiling();
+    tilingOptionsCache().store(key, options);
+
+    return options;
+}
+
 std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
     const auto& env = CompileEnv::get();
 
@@ -645,6 +750,13 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
     const auto cmxLimit = env.resources.tilingCMXLimit;
+    const auto withDmaCost = env.config.hwConvTilingDmaCost;
+
+    const auto& inputDims = _convolutionOptions._inputDims;
+    const double inputBytes = static_cast<double>(sizeof(fp16_t)) * inputDims[Dim::W] * inputDims[Dim::H] * inputDims[Dim::C];
+    const double weightsBytes = static_cast<double>(sizeof(fp16_t))
+                                * _convolutionOptions._kernelSizeX * _convolutionOptions._kernelSizeY
+                                * inputDims[Dim::C] * outputTileInitial[Dim::C];
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
@@ -738,7 +850,8 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                 }
 
                 bool isOK = true;
-                double solutionCost = 0.0;
+                TilingCost solutionCost;
+                double inputTilesBytes = 0.0;
 
                 for (const auto& heightTile : heightTiles) {
                     for (const auto& widthTile : widthTiles) {
@@ -798,27 +911,35 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                         // Calc tile cost.
                         //
 
-                        solutionCost += tileInfo.cost * numChannelTiles;
+                        solutionCost.hwOps += tileInfo.cost * numChannelTiles;
 
                         // Alignment for output
                         if ((widthTile.outputStartIndex * sizeof(fp16_t)) % 16 != 0) {
-                            solutionCost += static_cast<double>(widthTile.outputWithJunk)
-                                            * heightTile.outputWithJunk
-                                            * outputTileInitial[Dim::C];
+                            solutionCost.dmaBytes += static_cast<double>(sizeof(fp16_t))
+                                                     * widthTile.outputWithJunk
+                                                     * heightTile.outputWithJunk
+                                                     * outputTileInitial[Dim::C];
                         }
 
                         // Alignment for input
                         if ((widthTile.inputStartIndex * sizeof(fp16_t)) % 16 != 0) {
-                            solutionCost += static_cast<double>(widthTile.inputWithJunk)
-                                            * heightTile.inputWithJunk
-                                            * tileInfo.extendedInputDimC;
+                            solutionCost.dmaBytes += static_cast<double>(sizeof(fp16_t))
+                                                     * widthTile.inputWithJunk
+                                                     * heightTile.inputWithJunk
+                                                     * tileInfo.extendedInputDimC;
                         }
 
                         // SoC overhead
-                        solutionCost += static_cast<double>((numChannelTiles - 1))
-                                        * widthTile.outputWithJunk
-                                        * heightTile.outputWithJunk
-                                        * outputTileInitial[Dim::C];
+                        solutionCost.dmaBytes += static_cast<double>(sizeof(fp16_t))
+                                                 * (numChannelTiles - 1)
+                                                 * widthTile.outputWithJunk
+                                                 * heightTile.outputWithJunk
+                                                 * outputTileInitial[Dim::C];
+
+                        inputTilesBytes += static_cast<double>(sizeof(fp16_t))
+                                           * widthTile.inputWithJunk
+                                           * heightTile.inputWithJunk
+                                           * inputDims[Dim::C];
                     }
 
                     if (!isOK) {
@@ -830,12 +951,22 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                     continue;
                 }
 
+                if (withDmaCost) {
+                    // Overlapping input tiles read the same input lines several times
+                    solutionCost.dmaBytes += std::max(0.0, inputTilesBytes - inputBytes);
+
+                    // Each plane tile loads the whole weights
+                    const auto numPlaneTiles = heightTiles.size() * widthTiles.size();
+                    solutionCost.dmaBytes += static_cast<double>(numPlaneTiles - 1) * weightsBytes;
+                }
+
                 //
                 // Put to the pool of best options.
                 //
 
                 const int totalNumTiles = numWidthTiles * numHeightTiles * numChannelTiles;
-                tilingOptions.push({numWidthTiles, numHeightTiles, numChannelTiles, totalNumTiles, solutionCost});
+                tilingOptions.push({numWidthTiles, numHeightTiles, numChannelTiles, totalNumTiles,
+                                    solutionCost.total(), solutionCost});
 
                 // Skip smaller SoC tiling.
                 break;
@@ -858,7 +989,8 @@ std::ostream& operator<<(std::ostream& stream, const TilingOption& tilingOption)
            << tilingOption.numWidthTiles << "x"
            << tilingOption.numHeightTiles << "x"
            << tilingOption.numChannelTiles
-           << " Tot: " << tilingOption.totalNumTiles << " " << " cost: " << tilingOption.cost;
+           << " Tot: " << tilingOption.totalNumTiles << " " << " cost: " << tilingOption.cost
+           << " (HW ops: " << tilingOption.costTerms.hwOps << ", DMA bytes: " << tilingOption.costTerms.dmaBytes << ")";
 
     return stream;
 }
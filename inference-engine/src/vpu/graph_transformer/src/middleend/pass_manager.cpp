@@ -4,13 +4,24 @@
 
 #include <vpu/middleend/pass_manager.hpp>
 
+#include <cmath>
 #include <sstream>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <vector>
+#include <utility>
 
 #include <vpu/compile_env.hpp>
 
+#ifdef _WIN32
+# include <windows.h>
+# include <psapi.h>
+#elif defined(__linux__)
+# include <unistd.h>
+#endif
+
 namespace vpu {
 
 //
@@ -31,7 +42,45 @@ void PerStagePass::run(const Model& model) {
 // PassSet
 //
 
-void PassSet::run(const Model& model) const {
+namespace {
+
+std::int64_t residentMemoryBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<std::int64_t>(counters.WorkingSetSize);
+    }
+#elif defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    std::int64_t totalPages = 0, residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * sysconf(_SC_PAGESIZE);
+    }
+#endif
+    return 0;
+}
+
+void printPassesReport(const Logger::Ptr& log, const std::vector<PassStatistics>& statistics) {
+    double totalDurationMs = 0.0;
+    for (const auto& pass : statistics) {
+        totalDurationMs += pass.durationMs;
+    }
+
+    log->info("MiddleEnd : passes report, total duration : %f ms", totalDurationMs);
+    VPU_LOGGER_SECTION(log);
+
+    for (const auto& pass : statistics) {
+        log->info(
+            "%s : %f ms (%f%%) stages : %d datas : %d memory delta : %d KB",
+            pass.name, pass.durationMs,
+            totalDurationMs > 0.0 ? std::round(1000.0 * pass.durationMs / totalDurationMs) / 10.0 : 0.0,
+            pass.numStages, pass.numDatas, pass.memoryDeltaBytes / 1024);
+    }
+}
+
+}  // namespace
+
+std::vector<PassStatistics> PassSet::run(const Model& model) const {
     using MilliSecondsFP64 = std::chrono::duration<double, std::milli>;
 
     const auto& env = CompileEnv::get();
@@ -39,11 +88,15 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    std::vector<PassStatistics> statistics;
+    statistics.reserve(_passes.size());
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
         VPU_LOGGER_SECTION(env.log);
 
+        const auto startMemory = residentMemoryBytes();
         auto startTime = std::chrono::high_resolution_clock::now();
 
         model->cleanUp();
@@ -52,15 +105,29 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        PassStatistics passStatistics;
+        passStatistics.name = p.second;
+        passStatistics.durationMs = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+        passStatistics.numStages = model->numStages();
+        passStatistics.numDatas = model->numDatas();
+        passStatistics.memoryDeltaBytes = residentMemoryBytes() - startMemory;
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, passStatistics.durationMs);
+
+        statistics.push_back(std::move(passStatistics));
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    if (env.log->isActive(LogLevel::Info)) {
+        printPassesReport(env.log, statistics);
+    }
+
+    return statistics;
 }
 
 //
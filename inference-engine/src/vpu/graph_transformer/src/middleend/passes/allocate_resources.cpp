@@ -201,6 +201,22 @@ AllocationResult runAllocator(const Model& model, EnableShapeAllocation enableSh
         }
     }
 
+    //
+    // Place BSS datas by interval packing of their lifetimes, before shapes refer to their offsets
+    //
+
+    const auto& env = CompileEnv::get();
+
+    if (env.config.enableBssIntervalPacking &&
+        enableShapeAllocation == EnableShapeAllocation::YES && checkOnlyCmx == CheckOnlyCMX::NO) {
+        const auto greedyBSS = allocator.usedMemoryAmount().BSS;
+
+        allocator.packBSSData();
+
+        env.log->info("BSS size : greedy allocation %d bytes, interval packing %d bytes",
+                      greedyBSS, allocator.usedMemoryAmount().BSS);
+    }
+
     //
     // Allocate shape for all datas
     //
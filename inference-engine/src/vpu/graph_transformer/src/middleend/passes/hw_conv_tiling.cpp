@@ -8,6 +8,10 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
+#include <exception>
+
+#include <ie_parallel.hpp>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -28,12 +32,52 @@ public:
     void run(const Model& model) override;
 
 private:
+    void tileStage(const Model& model, const Stage& origStage, const HWTilingNS::HWConvolutionTiler& tiler);
+
     StageBuilder::Ptr _stageBuilder;
 };
 
+//
+// Try to find "best" tiling
+//
+
+HWTilingNS::HWConvolutionTiler selectTiling(const HWTilingNS::ConvolutionOptions& convolutionOptions) {
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+
+    if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
+        const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
+            convolutionOptions._stageName,
+            convolutionOptions._inputDims,
+            convolutionOptions._origOutputDims,
+            convolutionOptions._origOutputDims,
+            convolutionOptions._kernelSizeX,
+            convolutionOptions._kernelSizeY,
+            convolutionOptions._kernelStride,
+            convolutionOptions._paddingLeft,
+            convolutionOptions._paddingRight,
+            convolutionOptions._paddingTop,
+            convolutionOptions._paddingBottom,
+            false
+        };
+
+        return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
+    }
+
+    return tiler1stAttempt;
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    StageVector hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> hwStagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -47,19 +91,8 @@ void PassImpl::run(const Model& model) {
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Unsupported paddings
-        //
-
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        hwStagesOptions.push_back(HWTilingNS::ConvolutionOptions{
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -72,167 +105,175 @@ void PassImpl::run(const Model& model) {
             stageOptions.padTop,
             stageOptions.padBottom,
             stageOptions.withPool
-        };
+        });
+    }
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+    //
+    // Tiling search depends only on the stage parameters, so it runs for all stages in parallel
+    // and the model is modified afterwards in the original stages order
+    //
 
-        //
-        // Use SW stage if tiling optimization failed
-        //
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(hwStages.size());
+    std::vector<std::exception_ptr> errors(hwStages.size());
 
-        if (!tiler.isTilingPossible()) {
-            origStage->attrs().set<bool>("tryHW", false);
+    ie::parallel_for(hwStages.size(), [&](size_t stageInd) {
+        const CompileEnv::WorkerScope workerScope(env);
 
-            auto swConvOutput = stageIO.origOutput;
-            if (stageOptions.withReLU || stageOptions.withPool || stageOptions.withClamp) {
-                swConvOutput = model->addNewData(origStage->name(), stageIO.origOutputDesc);
-                swConvOutput->attrs().copyFrom(stageIO.origOutput->attrs());
+        try {
+            tilers[stageInd].reset(new HWTilingNS::HWConvolutionTiler(selectTiling(hwStagesOptions[stageInd])));
+        } catch (...) {
+            errors[stageInd] = std::current_exception();
+        }
+    });
 
-                model->replaceStageOutput(origStage->outputEdge(0), swConvOutput);
-            }
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        if (errors[stageInd] != nullptr) {
+            std::rethrow_exception(errors[stageInd]);
+        }
 
-            auto hwPoolInput = swConvOutput;
-            if (stageOptions.withReLU) {
-                auto swReluOutput = stageIO.origOutput;
-                if (stageOptions.withPool) {
-                    swReluOutput = model->addNewData(origStage->name() + "@ReLU", stageIO.origOutputDesc);
-                    swReluOutput->attrs().copyFrom(stageIO.origOutput->attrs());
-                }
-
-                _stageBuilder->addReLUStage(
-                    model,
-                    origStage->name() + "@ReLU",
-                    origStage->origLayer(),
-                    stageOptions.negativeSlope,
-                    swConvOutput,
-                    swReluOutput);
-
-                hwPoolInput = swReluOutput;
-            }
+        // Estimated costs are compared with the measured per-stage timings to tune the cost model
+        env.log->trace("Stage [%s] HW tiling options : %v", hwStages[stageInd]->name(), tilers[stageInd]->tilingOptions());
 
-            if (stageOptions.withClamp) {
-                auto swClampOutput = stageIO.origOutput;
-                if (stageOptions.withPool) {
-                    swClampOutput = model->addNewData(origStage->name() + "@Clamp", stageIO.origOutputDesc);
-                    swClampOutput->attrs().copyFrom(stageIO.origOutput->attrs());
-                }
-
-                _stageBuilder->addClampStage(
-                    model,
-                    origStage->name() + "@Clamp",
-                    origStage->origLayer(),
-                    0.0,
-                    stageOptions.clampMax,
-                    swConvOutput,
-                    swClampOutput);
-
-                hwPoolInput = swClampOutput;
-            }
+        tileStage(model, hwStages[stageInd], *tilers[stageInd]);
+    }
+}
 
-            if (stageOptions.withPool) {
-                auto hwPoolStage = model->addNewStage<StubStage>(
-                    origStage->name() + "@Pool",
-                    StageType::StubMaxPool,
-                    origStage->origLayer(),
-                    {hwPoolInput},
-                    {stageIO.origOutput});
+void PassImpl::tileStage(const Model& model, const Stage& origStage, const HWTilingNS::HWConvolutionTiler& tiler) {
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-                hwPoolStage->attrs().set<int>("kernelSizeX", stageOptions.poolKernelSizeX);
-                hwPoolStage->attrs().set<int>("kernelSizeY", stageOptions.poolKernelSizeY);
+    //
+    // Use SW stage if tiling optimization failed
+    //
 
-                hwPoolStage->attrs().set<int>("kernelStrideX", stageOptions.poolKernelStride);
-                hwPoolStage->attrs().set<int>("kernelStrideY", stageOptions.poolKernelStride);
+    if (!tiler.isTilingPossible()) {
+        origStage->attrs().set<bool>("tryHW", false);
 
-                hwPoolStage->attrs().set<int>("padLeft", stageOptions.poolPadLeft);
-                hwPoolStage->attrs().set<int>("padRight", stageOptions.poolPadRight);
-                hwPoolStage->attrs().set<int>("padTop", stageOptions.poolPadTop);
-                hwPoolStage->attrs().set<int>("padBottom", stageOptions.poolPadBottom);
+        auto swConvOutput = stageIO.origOutput;
+        if (stageOptions.withReLU || stageOptions.withPool || stageOptions.withClamp) {
+            swConvOutput = model->addNewData(origStage->name(), stageIO.origOutputDesc);
+            swConvOutput->attrs().copyFrom(stageIO.origOutput->attrs());
 
-                hwPoolStage->attrs().set<bool>("excludePad", false);
+            model->replaceStageOutput(origStage->outputEdge(0), swConvOutput);
+        }
 
-                hwPoolStage->attrs().set<bool>("tryHW", true);
+        auto hwPoolInput = swConvOutput;
+        if (stageOptions.withReLU) {
+            auto swReluOutput = stageIO.origOutput;
+            if (stageOptions.withPool) {
+                swReluOutput = model->addNewData(origStage->name() + "@ReLU", stageIO.origOutputDesc);
+                swReluOutput->attrs().copyFrom(stageIO.origOutput->attrs());
             }
 
-            continue;
+            _stageBuilder->addReLUStage(
+                model,
+                origStage->name() + "@ReLU",
+                origStage->origLayer(),
+                stageOptions.negativeSlope,
+                swConvOutput,
+                swReluOutput);
+
+            hwPoolInput = swReluOutput;
         }
 
-        model->disconnectStage(origStage);
+        if (stageOptions.withClamp) {
+            auto swClampOutput = stageIO.origOutput;
+            if (stageOptions.withPool) {
+                swClampOutput = model->addNewData(origStage->name() + "@Clamp", stageIO.origOutputDesc);
+                swClampOutput->attrs().copyFrom(stageIO.origOutput->attrs());
+            }
 
-        for (const auto &tiling : tiler.getHwTilings()) {
-            HWConvStageTiler hwStageTiler(
-                stageOptions,
-                stageIO,
+            _stageBuilder->addClampStage(
                 model,
-                origStage,
-                _stageBuilder,
-                tiling,
-                stageOptions.withPool && !tiler.withPool());
-
-            //
-            // Split/concat input/output tiles
-            //
-
-            if (!hwStageTiler.hwInputTiles.empty()) {
-                _stageBuilder->addSplitStage(
-                    model,
-                    origStage->name() + "@split-input",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwInputTilesOffsets),
-                    hwStageTiler.hwInput,
-                    hwStageTiler.hwInputTiles);
-            }
+                origStage->name() + "@Clamp",
+                origStage->origLayer(),
+                0.0,
+                stageOptions.clampMax,
+                swConvOutput,
+                swClampOutput);
+
+            hwPoolInput = swClampOutput;
+        }
 
-            if (!hwStageTiler.hwWeightsTiles.empty()) {
-                _stageBuilder->addSplitStage(
-                    model,
-                    origStage->name() + "@split-input2",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwWeightsTilesOffsets),
-                    stageIO.origWeights,
-                    hwStageTiler.hwWeightsTiles);
-            }
+        if (stageOptions.withPool) {
+            auto hwPoolStage = model->addNewStage<StubStage>(
+                origStage->name() + "@Pool",
+                StageType::StubMaxPool,
+                origStage->origLayer(),
+                {hwPoolInput},
+                {stageIO.origOutput});
 
-            if (!hwStageTiler.hwOutputTiles.empty()) {
-                _stageBuilder->addConcatStage(
-                    model,
-                    origStage->name() + "@concat-output",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwOutputTilesOffsets),
-                    hwStageTiler.hwOutputTiles,
-                    hwStageTiler.hwOutput);
-            }
+            hwPoolStage->attrs().set<int>("kernelSizeX", stageOptions.poolKernelSizeX);
+            hwPoolStage->attrs().set<int>("kernelSizeY", stageOptions.poolKernelSizeY);
+
+            hwPoolStage->attrs().set<int>("kernelStrideX", stageOptions.poolKernelStride);
+            hwPoolStage->attrs().set<int>("kernelStrideY", stageOptions.poolKernelStride);
+
+            hwPoolStage->attrs().set<int>("padLeft", stageOptions.poolPadLeft);
+            hwPoolStage->attrs().set<int>("padRight", stageOptions.poolPadRight);
+            hwPoolStage->attrs().set<int>("padTop", stageOptions.poolPadTop);
+            hwPoolStage->attrs().set<int>("padBottom", stageOptions.poolPadBottom);
+
+            hwPoolStage->attrs().set<bool>("excludePad", false);
+
+            hwPoolStage->attrs().set<bool>("tryHW", true);
         }
 
+        return;
+    }
+
+    model->disconnectStage(origStage);
+
+    for (const auto &tiling : tiler.getHwTilings()) {
+        HWConvStageTiler hwStageTiler(
+            stageOptions,
+            stageIO,
+            model,
+            origStage,
+            _stageBuilder,
+            tiling,
+            stageOptions.withPool && !tiler.withPool());
+
         //
-        // Remove original stage
+        // Split/concat input/output tiles
         //
 
-        model->removeStage(origStage);
+        if (!hwStageTiler.hwInputTiles.empty()) {
+            _stageBuilder->addSplitStage(
+                model,
+                origStage->name() + "@split-input",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwInputTilesOffsets),
+                hwStageTiler.hwInput,
+                hwStageTiler.hwInputTiles);
+        }
+
+        if (!hwStageTiler.hwWeightsTiles.empty()) {
+            _stageBuilder->addSplitStage(
+                model,
+                origStage->name() + "@split-input2",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwWeightsTilesOffsets),
+                stageIO.origWeights,
+                hwStageTiler.hwWeightsTiles);
+        }
+
+        if (!hwStageTiler.hwOutputTiles.empty()) {
+            _stageBuilder->addConcatStage(
+                model,
+                origStage->name() + "@concat-output",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwOutputTilesOffsets),
+                hwStageTiler.hwOutputTiles,
+                hwStageTiler.hwOutput);
+        }
     }
+
+    //
+    // Remove original stage
+    //
+
+    model->removeStage(origStage);
 }
 
 }  // namespace
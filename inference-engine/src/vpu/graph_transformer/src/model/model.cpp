@@ -17,6 +17,7 @@
 #include <set>
 #include <exception>
 #include <algorithm>
+#include <vector>
 
 namespace vpu {
 
@@ -1994,12 +1995,72 @@ void ModelObj::buildStageOrder() const {
 
     IE_ASSERT(!_initialStages.empty());
 
-    StageMap<bool> visitedMap;
+    //
+    // Run DFS algorithm with explicit stack, so long chains of stages don't overflow the call stack.
+    // Visit states are indexed by stage id to avoid hashing of Stage handles.
+    //
+
+    enum class VisitState : uint8_t {
+        NotVisited,
+        InProgress,
+        Done
+    };
+
+    struct Frame final {
+        Stage stage;
+        size_t nextStagesBegin;
+    };
+
+    std::vector<VisitState> visitStates(static_cast<size_t>(_stagesIdCount), VisitState::NotVisited);
+    std::vector<Frame> frames;
+    std::vector<Stage> pendingNextStages;
+
+    const auto enterStage = [&](const Stage& stage) {
+        IE_ASSERT(stage->_parentStageEdge == nullptr);
+
+        visitStates[stage->id()] = VisitState::InProgress;
+
+        const auto nextStagesBegin = pendingNextStages.size();
+        for (const auto& nextStage : stage->nextStages()) {
+            pendingNextStages.push_back(nextStage);
+        }
+        if (_nextStagesComparator) {
+            std::sort(pendingNextStages.begin() + nextStagesBegin, pendingNextStages.end(), _nextStagesComparator);
+        }
+
+        frames.push_back({stage, nextStagesBegin});
+    };
 
     // Traverse input Stages in reverse order, because the algorithm uses push_front.
     // With reverse order at the loop we will get original order in result.
-    for (const auto& stage : _initialStages | asRange() | reverse()) {
-        runDFS(stage, visitedMap);
+    for (const auto& initialStage : _initialStages | asRange() | reverse()) {
+        enterStage(initialStage);
+
+        while (!frames.empty()) {
+            // Next Stages are taken from the back, that is in reverse order, for the same reason.
+            if (pendingNextStages.size() == frames.back().nextStagesBegin) {
+                const auto stage = frames.back().stage;
+                frames.pop_back();
+
+                visitStates[stage->id()] = VisitState::Done;
+                _orderedStageList.push_front(stage);
+
+                continue;
+            }
+
+            const auto nextStage = pendingNextStages.back();
+            pendingNextStages.pop_back();
+
+            const auto visitState = visitStates[nextStage->id()];
+            if (visitState == VisitState::InProgress) {
+                VPU_THROW_EXCEPTION << "Graph has cycle";
+            }
+            if (visitState == VisitState::Done) {
+                continue;
+            }
+
+            enterStage(nextStage);
+        }
     }
 
     IE_ASSERT(_orderedStageList.size() == _stagePtrList.size());
@@ -2046,40 +2107,6 @@ void ModelObj::removeStagesOrder(const Stage& parent, const Stage& child) {
     }
 }
 
-void ModelObj::runDFS(
-        const Stage& stage,
-        StageMap<bool>& visitedMap) const {
-    IE_ASSERT(stage->_parentStageEdge == nullptr);
-
-    visitedMap[stage] = false;
-
-    auto nextStages = stage->nextStages() | asSmallVector();
-    if (_nextStagesComparator)
-        std::sort(nextStages.begin(), nextStages.end(), _nextStagesComparator);
-
-    // Traverse next Stages in reverse order, because the algorithm uses push_front.
-    // With reverse order at the loop we will get original order in result.
-    for (const auto& nextStage : nextStages | asRange() | reverse()) {
-        auto it = visitedMap.find(nextStage);
-
-        if (it != visitedMap.end()) {
-            auto visited = it->second;
-
-            if (!visited) {
-                VPU_THROW_EXCEPTION << "Graph has cycle";
-            }
-
-            continue;
-        }
-
-        runDFS(nextStage, visitedMap);
-    }
-
-    visitedMap[stage] = true;
-
-    _orderedStageList.push_front(stage);
-}
-
 Stage ModelObj::addNewStageImpl(
     const std::string& name,
     StageType type,
@@ -69,6 +69,8 @@ IE_SUPPRESS_DEPRECATED_START
         ie::MYRIAD_DISABLE_CONVERT_STAGES,
         ie::MYRIAD_ENABLE_WEIGHTS_ANALYSIS,
         ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION,
+        ie::MYRIAD_ENABLE_BSS_INTERVAL_PACKING,
+        ie::MYRIAD_HW_CONV_TILING_DMA_COST,
 
         //
         // Debug options
@@ -186,6 +188,8 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.disableConvertStages,           switches, config, ie::MYRIAD_DISABLE_CONVERT_STAGES);
     setOption(_compileConfig.enableWeightsAnalysis,          switches, config, ie::MYRIAD_ENABLE_WEIGHTS_ANALYSIS);
     setOption(_compileConfig.enableEarlyEltwiseReLUFusion,   switches, config, ie::MYRIAD_ENABLE_EARLY_ELTWISE_RELU_FUSION);
+    setOption(_compileConfig.enableBssIntervalPacking,       switches, config, ie::MYRIAD_ENABLE_BSS_INTERVAL_PACKING);
+    setOption(_compileConfig.hwConvTilingDmaCost,            switches, config, ie::MYRIAD_HW_CONV_TILING_DMA_COST);
 
     setOption(_compileConfig.irWithVpuScalesDir,                       config, ie::MYRIAD_IR_WITH_SCALES_DIRECTORY);
     setOption(_compileConfig.noneLayers,                               config, ie::MYRIAD_NONE_LAYERS, parseStringSet);
@@ -0,0 +1,192 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "ngraph/opsets/opset5.hpp"
+#include "transformations/serialize.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string> BinarySerializationParams;
+
+class BinarySerializationTest: public CommonTestUtils::TestsCommon,
+                               public testing::WithParamInterface<BinarySerializationParams> {
+public:
+    const std::string m_out_model_path = "test_binary.irb";
+    const std::string m_out_bin_path = "test_binary.bin";
+
+    void TearDown() override {
+        std::remove(m_out_model_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+};
+
+TEST_P(BinarySerializationTest, CompareFunctions) {
+    const auto & model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(model_path);
+    ngraph::pass::Serialize(m_out_model_path, m_out_bin_path,
+                            ngraph::pass::Serialize::Version::IR_V10_BINARY).run_on_function(expected.getFunction());
+    auto result = ie.ReadNetwork(m_out_model_path, m_out_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction());
+    ASSERT_TRUE(success) << message;
+}
+
+INSTANTIATE_TEST_CASE_P(IRSerialization, BinarySerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml"),
+                        std::make_tuple("split_equal_parts_2d.xml"),
+                        std::make_tuple("addmul_abc.xml"),
+                        std::make_tuple("add_abc_initializers.xml"),
+                        std::make_tuple("nms5.xml"),
+                        std::make_tuple("shape_of.xml")));
+
+INSTANTIATE_TEST_CASE_P(ONNXSerialization, BinarySerializationTest,
+        testing::Values(std::make_tuple("add_abc.prototxt"),
+                        std::make_tuple("split_equal_parts_2d.prototxt"),
+                        std::make_tuple("addmul_abc.prototxt"),
+                        std::make_tuple("add_abc_initializers.prototxt")));
+
+namespace {
+
+std::shared_ptr<ngraph::Function> create_conv_chain(size_t length) {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8, 32, 32});
+    ngraph::Output<ngraph::Node> output = param;
+    for (size_t i = 0; i < length; i++) {
+        auto weights = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{8, 8, 3, 3},
+                                                        std::vector<float>(8 * 8 * 3 * 3, 0.01f * i));
+        auto conv = std::make_shared<ngraph::opset5::Convolution>(output, weights,
+                                                                  ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1});
+        auto bias = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8, 1, 1},
+                                                     std::vector<float>(8, 0.1f));
+        output = std::make_shared<ngraph::opset5::Relu>(std::make_shared<ngraph::opset5::Add>(conv, bias));
+    }
+    auto result = std::make_shared<ngraph::opset5::Result>(output);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "conv_chain");
+}
+
+}  // namespace
+
+class BinarySerializationFunctionTest : public ::testing::Test {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_xml_bin_path = test_name + "_xml.bin";
+    std::string m_out_model_path = test_name + ".irb";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_xml_bin_path.c_str());
+        std::remove(m_out_model_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+
+    void serialize(const std::shared_ptr<ngraph::Function>& function) {
+        ngraph::pass::Serialize(m_out_xml_path, m_out_xml_bin_path).run_on_function(function);
+        ngraph::pass::Serialize(m_out_model_path, m_out_bin_path,
+                                ngraph::pass::Serialize::Version::IR_V10_BINARY).run_on_function(function);
+    }
+
+    static std::string read_file(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    InferenceEngine::Blob::Ptr read_weights() const {
+        const auto bin = read_file(m_out_bin_path);
+        auto weights = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, {bin.size()},
+                                                                   InferenceEngine::C});
+        weights->allocate();
+        std::copy(bin.begin(), bin.end(), weights->buffer().as<char*>());
+        return weights;
+    }
+};
+
+TEST_F(BinarySerializationFunctionTest, ParityWithXml) {
+    serialize(create_conv_chain(4));
+
+    InferenceEngine::Core ie;
+    auto from_xml = ie.ReadNetwork(m_out_xml_path, m_out_xml_bin_path);
+    auto from_binary = ie.ReadNetwork(m_out_model_path, m_out_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(from_binary.getFunction(), from_xml.getFunction());
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_F(BinarySerializationFunctionTest, ReadFromMemory) {
+    serialize(create_conv_chain(2));
+
+    InferenceEngine::Core ie;
+    auto from_memory = ie.ReadNetwork(read_file(m_out_model_path), read_weights());
+    auto from_file = ie.ReadNetwork(m_out_model_path, m_out_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(from_memory.getFunction(), from_file.getFunction());
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_F(BinarySerializationFunctionTest, ConstantsAliasAlignedWeights) {
+    serialize(create_conv_chain(3));
+
+    auto weights = read_weights();
+    const auto base = weights->cbuffer().as<const char*>();
+
+    InferenceEngine::Core ie;
+    auto network = ie.ReadNetwork(read_file(m_out_model_path), weights);
+    for (const auto& op : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset5::Constant>(op)) {
+            const auto data = static_cast<const char*>(constant->get_data_ptr());
+            ASSERT_GE(data, base);
+            ASSERT_LT(data, base + weights->byteSize());
+            ASSERT_EQ(0, (data - base) % 64);
+        }
+    }
+}
+
+TEST_F(BinarySerializationFunctionTest, TruncatedModelThrows) {
+    serialize(create_conv_chain(2));
+
+    auto model = read_file(m_out_model_path);
+    model.resize(model.size() / 2);
+    std::ofstream(m_out_model_path, std::ios::binary) << model;
+
+    InferenceEngine::Core ie;
+    ASSERT_THROW(ie.ReadNetwork(m_out_model_path, m_out_bin_path), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BinarySerializationFunctionTest, DISABLED_LoadTime) {
+    const size_t iterations = 10;
+    serialize(create_conv_chain(2000));
+
+    InferenceEngine::Core ie;
+    auto measure = [&](const std::string& model, const std::string& bin) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            ie.ReadNetwork(model, bin);
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count() / iterations;
+    };
+
+    std::cout << "XML IR load time : " << measure(m_out_xml_path, m_out_xml_bin_path) << " micros" << std::endl;
+    std::cout << "Binary IR load time : " << measure(m_out_model_path, m_out_bin_path) << " micros" << std::endl;
+}
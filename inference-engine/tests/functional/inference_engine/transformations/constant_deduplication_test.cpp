@@ -0,0 +1,126 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/constant_deduplication.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, ConstantDeduplicationMergesEqualConstants) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    std::shared_ptr<ngraph::pass::ConstantDeduplication> deduplication;
+    {
+        auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto scale1 = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul1 = std::make_shared<ngraph::opset5::Multiply>(data, scale1);
+        auto scale2 = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul2 = std::make_shared<ngraph::opset5::Multiply>(mul1, scale2);
+        auto scale3 = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul3 = std::make_shared<ngraph::opset5::Multiply>(mul2, scale3);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul3}, ngraph::ParameterVector{data});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        deduplication = manager.register_pass<ngraph::pass::ConstantDeduplication>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto scale = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto mul1 = std::make_shared<ngraph::opset5::Multiply>(data, scale);
+        auto mul2 = std::make_shared<ngraph::opset5::Multiply>(mul1, scale);
+        auto mul3 = std::make_shared<ngraph::opset5::Multiply>(mul2, scale);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul3}, ngraph::ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(2 * 3 * sizeof(float), deduplication->get_saved_bytes());
+}
+
+TEST(TransformationTests, ConstantDeduplicationKeepsDifferentConstants) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::i32, ngraph::Shape{2, 2});
+        // same bytes as the first constant but different shape
+        auto add1 = std::make_shared<ngraph::opset5::Add>(data,
+            ngraph::opset5::Constant::create(ngraph::element::i32, ngraph::Shape{2, 2}, {1, 2, 3, 4}));
+        auto add2 = std::make_shared<ngraph::opset5::Add>(add1,
+            ngraph::opset5::Constant::create(ngraph::element::i32, ngraph::Shape{1, 4}, {1, 2, 3, 4}));
+        auto add3 = std::make_shared<ngraph::opset5::Add>(add2,
+            ngraph::opset5::Constant::create(ngraph::element::i32, ngraph::Shape{2, 2}, {1, 2, 3, 5}));
+        // same bytes as i32 {1, 2, 3, 4} but different element type
+        auto convert = std::make_shared<ngraph::opset5::Convert>(
+            ngraph::opset5::Constant::create(ngraph::element::u32, ngraph::Shape{2, 2}, {1, 2, 3, 4}),
+            ngraph::element::i32);
+        auto add4 = std::make_shared<ngraph::opset5::Add>(add3, convert);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{add4}, ngraph::ParameterVector{data});
+    };
+    f = create_function();
+    f_ref = create_function();
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    auto deduplication = manager.register_pass<ngraph::pass::ConstantDeduplication>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(0, deduplication->get_saved_bytes());
+}
+
+TEST(TransformationTests, ConstantDeduplicationKeepsOutputConstants) {
+    auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{2});
+    auto bias = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {1, 2});
+    auto add = std::make_shared<ngraph::opset5::Add>(data, bias);
+    auto output_constant = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {1, 2});
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{add, output_constant}, ngraph::ParameterVector{data});
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::ConstantDeduplication>();
+    manager.run_passes(f);
+
+    ASSERT_EQ(output_constant, f->get_results()[1]->get_input_node_shared_ptr(0));
+    ASSERT_EQ(bias, add->get_input_node_shared_ptr(1));
+}
+
+TEST(TransformationTests, ConstantDeduplicationLargeConstants) {
+    const ngraph::Shape shape{256, 1024};
+    const std::vector<float> values(ngraph::shape_size(shape), 0.5f);
+
+    auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    std::shared_ptr<ngraph::Node> output = data;
+    for (size_t i = 0; i < 8; i++) {
+        output = std::make_shared<ngraph::opset5::Add>(output,
+            ngraph::opset5::Constant::create(ngraph::element::f32, shape, values));
+    }
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{data});
+
+    ngraph::pass::Manager manager;
+    auto deduplication = manager.register_pass<ngraph::pass::ConstantDeduplication>();
+    manager.run_passes(f);
+
+    size_t constants = 0;
+    for (const auto& op : f->get_ops()) {
+        constants += ngraph::is_type<ngraph::opset5::Constant>(op);
+    }
+    ASSERT_EQ(1, constants);
+    ASSERT_EQ(7 * values.size() * sizeof(float), deduplication->get_saved_bytes());
+}
@@ -295,4 +295,27 @@ TEST_F(TypeRelaxedTests, OneOutputMultipleInputPorts) {
         relaxed_op->validate_and_infer_types();
         ASSERT_EQ(param1->output(0).get_element_type(), element::i64);
     }
-}
\ No newline at end of file
+}
+TEST_F(TypeRelaxedTests, setTypesMarksForRevalidation) {
+    ngraph::PartialShape shape({1, 3, 22, 22});
+    auto param1 = make_shared<ngraph::opset1::Parameter>(element::u8, shape);
+    auto param2 = make_shared<ngraph::opset1::Parameter>(element::u8, shape);
+    auto relaxed_op = make_shared<ngraph::op::TypeRelaxed<ngraph::opset1::Add>>(param1, param2);
+    auto result = make_shared<ngraph::opset1::Result>(relaxed_op);
+    auto f = make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param1, param2});
+    ASSERT_FALSE(relaxed_op->needs_revalidation());
+
+    // only the marked nodes are validated again between the passes
+    relaxed_op->set_origin_input_type(element::i8, 0);
+    relaxed_op->set_origin_input_type(element::i8, 1);
+    ASSERT_TRUE(relaxed_op->needs_revalidation());
+    f->validate_changed_nodes_and_infer_types();
+    ASSERT_EQ(element::i8, relaxed_op->get_output_element_type(0));
+    ASSERT_EQ(element::i8, result->get_output_element_type(0));
+
+    relaxed_op->set_overridden_output_type(element::f32, 0);
+    ASSERT_TRUE(relaxed_op->needs_revalidation());
+    f->validate_changed_nodes_and_infer_types();
+    ASSERT_EQ(element::f32, relaxed_op->get_output_element_type(0));
+    ASSERT_EQ(element::f32, result->get_output_element_type(0));
+}
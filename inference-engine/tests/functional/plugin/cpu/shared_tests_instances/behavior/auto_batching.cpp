@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "behavior/auto_batching.hpp"
+
+using namespace BehaviorTestsDefinitions;
+namespace {
+    INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, AutoBatchingTests,
+            ::testing::Combine(
+            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+            ::testing::Values(2, 4)),
+            AutoBatchingTests::getTestCaseName);
+
+    const std::vector<std::map<std::string, std::string>> autoBatchConfigs = {
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG, "CPU(4)"}},
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG, "CPU(4)"},
+                    {InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "0"}},
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG, "CPU(4)"},
+                    {InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "100"}}
+    };
+
+    INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, AutoBatchingConfigTests,
+            ::testing::Combine(
+            ::testing::Values(InferenceEngine::Precision::FP32),
+            ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+            ::testing::ValuesIn(autoBatchConfigs)),
+            AutoBatchingConfigTests::getTestCaseName);
+}  // namespace
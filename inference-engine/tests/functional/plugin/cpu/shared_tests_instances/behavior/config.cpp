@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "auto-batch/auto_batch_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -39,7 +40,13 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                     InferenceEngine::MultiDeviceConfigParams::MULTI_PRIORITY_ORDER}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                     InferenceEngine::MultiDeviceConfigParams::MULTI_LOWEST_COMPLETION_TIME}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -68,7 +75,9 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "NAN"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
@@ -76,6 +85,16 @@ namespace {
     };
 
 
+    const std::vector<std::map<std::string, std::string>> autoBatchInconfigs = {
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG , "CPU"}},
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG , "CPU(0)"}},
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG , "CPU(NAN)"}},
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG , "CPU(4)"},
+                    {InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "-1"}},
+            {{InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG , "CPU(4)"},
+                    {InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "NAN"}}
+    };
+
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigAPITests,
             ::testing::Combine(
             ::testing::ValuesIn(netPrecisions),
@@ -104,6 +123,13 @@ namespace {
             ::testing::ValuesIn(multiinconfigs)),
             IncorrectConfigTests::getTestCaseName);
 
+    INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, IncorrectConfigTests,
+            ::testing::Combine(
+            ::testing::Values(InferenceEngine::Precision::FP32),
+            ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+            ::testing::ValuesIn(autoBatchInconfigs)),
+            IncorrectConfigTests::getTestCaseName);
+
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, IncorrectConfigAPITests,
             ::testing::Combine(
             ::testing::ValuesIn(netPrecisions),
@@ -14,8 +14,6 @@ namespace {
 
 
     const std::vector<std::map<std::string, std::string>> inconfigs = {
-            {{InferenceEngine::GNAConfigParams::KEY_GNA_DEVICE_MODE, InferenceEngine::GNAConfigParams::GNA_SW_FP32},
-                    {InferenceEngine::GNAConfigParams::KEY_GNA_LIB_N_THREADS, "2"}},
             {{InferenceEngine::GNAConfigParams::KEY_GNA_SCALE_FACTOR, "NAN"}},
             {{InferenceEngine::GNAConfigParams::KEY_GNA_PRECISION, "FP8"}},
             {{InferenceEngine::GNAConfigParams::KEY_GNA_DEVICE_MODE, "AUTO"}},
@@ -48,7 +46,9 @@ namespace {
 
 
     const std::vector<std::map<std::string, std::string>> conf = {
-            {}
+            {},
+            {{InferenceEngine::GNAConfigParams::KEY_GNA_DEVICE_MODE, InferenceEngine::GNAConfigParams::GNA_SW_FP32},
+                    {InferenceEngine::GNAConfigParams::KEY_GNA_LIB_N_THREADS, "2"}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigAPITests,
@@ -0,0 +1,171 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "functional_test_utils/behavior_test_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace BehaviorTestsDefinitions {
+
+typedef std::tuple<
+        std::string,    // Device the requests are batched on
+        int             // Batch size
+> AutoBatchingParams;
+
+class AutoBatchingTests : public testing::WithParamInterface<AutoBatchingParams>,
+                          public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<AutoBatchingParams> obj) {
+        std::string deviceName;
+        int batchSize;
+        std::tie(deviceName, batchSize) = obj.param;
+        return "targetDevice=" + deviceName + "_batch=" + std::to_string(batchSize);
+    }
+
+    void SetUp() override {
+        std::tie(deviceName, batchSize) = this->GetParam();
+        // the network has no reshapes with the hardcoded batch, so it can be batched along the outermost dimension
+        function = ngraph::builder::subgraph::makeSingleConv();
+    }
+
+    void TearDown() override {
+        PluginCache::get().reset();
+        function.reset();
+    }
+
+protected:
+    InferenceEngine::ExecutableNetwork LoadBatchedNetwork(const int timeoutMs) {
+        InferenceEngine::CNNNetwork cnnNet(function);
+        const auto batchDevice = std::string{CommonTestUtils::DEVICE_BATCH} + ":" + deviceName +
+                                 "(" + std::to_string(batchSize) + ")";
+        return ie->LoadNetwork(cnnNet, batchDevice, {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), std::to_string(timeoutMs)}});
+    }
+
+    // starts the requests with their own data and checks every result against the network without batch
+    std::chrono::milliseconds InferAndValidate(std::vector<InferenceEngine::InferRequest>& requests) {
+        InferenceEngine::CNNNetwork cnnNet(function);
+        auto refExecNet = ie->LoadNetwork(cnnNet, deviceName);
+        auto refRequest = refExecNet.CreateInferRequest();
+        const auto inputName = cnnNet.getInputsInfo().begin()->first;
+        const auto outputName = cnnNet.getOutputsInfo().begin()->first;
+
+        std::vector<InferenceEngine::Blob::Ptr> inputs;
+        for (std::size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex) {
+            auto blob = FuncTestUtils::createAndFillBlob(requests[requestIndex].GetBlob(inputName)->getTensorDesc(),
+                                                         10, static_cast<int32_t>(requestIndex));
+            requests[requestIndex].SetBlob(inputName, blob);
+            inputs.push_back(blob);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            EXPECT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        for (std::size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex) {
+            refRequest.SetBlob(inputName, inputs[requestIndex]);
+            refRequest.Infer();
+            FuncTestUtils::compareBlobs(requests[requestIndex].GetBlob(outputName), refRequest.GetBlob(outputName));
+        }
+        return elapsed;
+    }
+
+    std::shared_ptr<InferenceEngine::Core> ie = PluginCache::get().ie();
+    std::shared_ptr<ngraph::Function> function;
+    std::string deviceName;
+    int batchSize = 0;
+};
+
+// the timeout is long enough to fail the test, so a full batch starts as soon as it is collected
+TEST_P(AutoBatchingTests, fullBatchStartsWithoutTimeout) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const int timeoutMs = 10000;
+    auto execNet = LoadBatchedNetwork(timeoutMs);
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (int requestIndex = 0; requestIndex < batchSize; ++requestIndex) {
+        requests.push_back(execNet.CreateInferRequest());
+    }
+    ASSERT_LT(InferAndValidate(requests).count(), timeoutMs);
+}
+
+TEST_P(AutoBatchingTests, partialBatchStartsOnTimeout) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const int timeoutMs = 200;
+    auto execNet = LoadBatchedNetwork(timeoutMs);
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (int requestIndex = 0; requestIndex < batchSize - 1; ++requestIndex) {
+        requests.push_back(execNet.CreateInferRequest());
+    }
+    ASSERT_GE(InferAndValidate(requests).count(), timeoutMs);
+}
+
+TEST_P(AutoBatchingTests, singleRequestWaitsNoLongerThanDefaultTimeout) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    InferenceEngine::CNNNetwork cnnNet(function);
+    auto execNet = ie->LoadNetwork(cnnNet, std::string{CommonTestUtils::DEVICE_BATCH} + ":" + deviceName +
+                                           "(" + std::to_string(batchSize) + ")");
+    ASSERT_EQ("5", execNet.GetConfig(AUTO_BATCH_CONFIG_KEY(TIMEOUT)).as<std::string>());
+    std::vector<InferenceEngine::InferRequest> requests = {execNet.CreateInferRequest()};
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        ASSERT_NO_FATAL_FAILURE(InferAndValidate(requests));
+    }
+}
+
+// with the slots taken on submission any requests of the network make up a full batch
+TEST_P(AutoBatchingTests, anyRequestsMakeFullBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const int timeoutMs = 10000;
+    auto execNet = LoadBatchedNetwork(timeoutMs);
+    std::vector<InferenceEngine::InferRequest> allRequests;
+    for (int requestIndex = 0; requestIndex < 2 * batchSize; ++requestIndex) {
+        allRequests.push_back(execNet.CreateInferRequest());
+    }
+    std::vector<InferenceEngine::InferRequest> oddRequests;
+    for (int requestIndex = 1; requestIndex < 2 * batchSize; requestIndex += 2) {
+        oddRequests.push_back(allRequests[requestIndex]);
+    }
+    ASSERT_LT(InferAndValidate(oddRequests).count(), timeoutMs);
+    // the requests run repeatedly and in a different order take the other slots
+    std::reverse(oddRequests.begin(), oddRequests.end());
+    ASSERT_LT(InferAndValidate(oddRequests).count(), timeoutMs);
+    ASSERT_LT(InferAndValidate(allRequests).count(), timeoutMs);
+}
+
+using AutoBatchingConfigTests = BehaviorTestsUtils::BehaviorTestsBasic;
+
+TEST_P(AutoBatchingConfigTests, canLoadNetworkWithConfig) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    InferenceEngine::CNNNetwork cnnNet(ngraph::builder::subgraph::makeSingleConv());
+    InferenceEngine::ExecutableNetwork execNet;
+    ASSERT_NO_THROW(execNet = ie->LoadNetwork(cnnNet, targetDevice, configuration));
+    for (auto&& item : configuration) {
+        ASSERT_EQ(item.second, execNet.GetConfig(item.first).as<std::string>());
+    }
+    std::vector<std::string> configKeys = execNet.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    for (auto&& key : {AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG), AUTO_BATCH_CONFIG_KEY(TIMEOUT)}) {
+        ASSERT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(), key));
+    }
+}
+
+}  // namespace BehaviorTestsDefinitions
@@ -6,9 +6,14 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ie_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include <algorithm>
 #include <random>
+#include <string>
+#include <vector>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -147,4 +152,106 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     ASSERT_NE(nullptr, cnnNetwork.getFunction());
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "2";
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    Run();
+    ASSERT_NE(nullptr, cnnNetwork.getFunction());
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelinedAsync) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    for (int pipelineDepth : {1, 2}) {
+        SCOPED_TRACE("pipeline depth " + std::to_string(pipelineDepth));
+        configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = std::to_string(pipelineDepth);
+        LoadNetwork();
+
+        // more user requests than subgraph requests in the pools, so the stages wait for the released requests
+        const int numRequests = 2 * pipelineDepth + 2;
+        std::vector<InferenceEngine::InferRequest> requests;
+        std::vector<std::vector<InferenceEngine::Blob::Ptr>> requestsInputs;
+        for (int requestIndex = 0; requestIndex < numRequests; ++requestIndex) {
+            auto request = executableNetwork.CreateInferRequest();
+            std::vector<InferenceEngine::Blob::Ptr> requestInputs;
+            for (const auto& input : executableNetwork.GetInputsInfo()) {
+                // every request gets its own data, so the results mixed up between the requests are caught
+                auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc(), 10, requestIndex);
+                request.SetBlob(input.first, blob);
+                requestInputs.push_back(blob);
+            }
+            requests.push_back(request);
+            requestsInputs.push_back(requestInputs);
+        }
+
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (int requestIndex = 0; requestIndex < numRequests; ++requestIndex) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK,
+                      requests[requestIndex].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            inferRequest = requests[requestIndex];
+            inputs = requestsInputs[requestIndex];
+            Validate();
+        }
+    }
+}
+
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackBoundaryPerfCounts) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+    for (int pipelineDepth : {0, 2}) {
+        SCOPED_TRACE("pipeline depth " + std::to_string(pipelineDepth));
+        configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = std::to_string(pipelineDepth);
+        LoadNetwork();
+
+        std::vector<InferenceEngine::InferRequest> requests;
+        for (int requestIndex = 0; requestIndex < 4; ++requestIndex) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+        }
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        // the boundaries are known since the request creation, so they are read while the other requests run
+        std::size_t numBoundaries = 0;
+        for (auto&& request : requests) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            std::size_t requestBoundaries = 0;
+            for (auto&& perfCount : request.GetPerformanceCounts()) {
+                if (perfCount.first.find("boundary: ") != 0) {
+                    continue;
+                }
+                ++requestBoundaries;
+                const std::string layerType = perfCount.second.layer_type;
+                const std::string execType = perfCount.second.exec_type;
+                ASSERT_EQ("HeteroBoundary", layerType);
+                const bool shared = execType.find("shared_") == 0;
+                ASSERT_TRUE(shared || execType.find("copy_") == 0) << execType;
+                ASSERT_EQ(shared ? InferenceEngine::InferenceEngineProfileInfo::NOT_RUN
+                                 : InferenceEngine::InferenceEngineProfileInfo::EXECUTED, perfCount.second.status);
+                const auto byteSize = std::stoul(execType.substr(execType.find('_') + 1));
+                ASSERT_GT(byteSize, 0u) << execType;
+                ASSERT_EQ(execType.size() - std::string{"_bytes"}.size(), execType.rfind("_bytes")) << execType;
+            }
+            // every request of the network crosses the same boundaries
+            if (&request != &requests.front()) {
+                ASSERT_EQ(numBoundaries, requestBoundaries);
+            }
+            numBoundaries = requestBoundaries;
+        }
+
+        const auto& majorPluginNodeIds = std::get<Function>(GetParam())._majorPluginNodeIds;
+        const auto orderedOps = function->get_ordered_ops();
+        const auto numLayers = std::count_if(orderedOps.begin(), orderedOps.end(),
+            [] (const std::shared_ptr<ngraph::Node>& node) {
+                return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+            });
+        if (!majorPluginNodeIds.empty() && static_cast<std::size_t>(numLayers) > majorPluginNodeIds.size()) {
+            ASSERT_GT(numBoundaries, 0u);
+        }
+    }
+}
+
 }  //  namespace HeteroTests
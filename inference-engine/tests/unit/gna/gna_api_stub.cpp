@@ -52,6 +52,9 @@ GNA2_API enum Gna2Status Gna2DeviceOpen(
 GNA2_API enum Gna2Status Gna2DeviceSetNumberOfThreads(
     uint32_t deviceIndex,
     uint32_t numberOfThreads) {
+    if (current != nullptr) {
+        return current->Gna2DeviceSetNumberOfThreads(deviceIndex, numberOfThreads);
+    }
     return Gna2StatusSuccess;
 }
 
@@ -0,0 +1,203 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+#include "runtime/gna_float_runtime.hpp"
+
+using GNAPluginNS::runtime::FP;
+
+namespace {
+
+std::vector<float> RandomVector(size_t size, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> values(size);
+    for (auto &value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+// straightforward i-j-k product, C = C + A * B
+void ReferenceSgemm(int M, int N, int K, const float *A, int lda, const float *B, int ldb, float *C, int ldc) {
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            float sum = C[i * ldc + j];
+            for (int k = 0; k < K; k++) {
+                sum += A[i * lda + k] * B[k * ldb + j];
+            }
+            C[i * ldc + j] = sum;
+        }
+    }
+}
+
+void ExpectNear(const std::vector<float> &expected, const std::vector<float> &actual, int K) {
+    ASSERT_EQ(expected.size(), actual.size());
+    // summation order differs from the reference
+    const float tolerance = 1e-6f * K + 1e-6f;
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], tolerance) << "at " << i;
+    }
+}
+
+}  // namespace
+
+// M, N, K
+typedef std::tuple<int, int, int> GemmShape;
+
+class GNAFloatMathTest : public ::testing::TestWithParam<GemmShape> {
+ protected:
+    void SetUp() override {
+        std::tie(M, N, K) = GetParam();
+        A = RandomVector(M * K, 1);
+        B = RandomVector(K * N, 2);
+        C = RandomVector(M * N, 3);
+    }
+
+    int M, N, K;
+    std::vector<float> A, B, C;
+};
+
+TEST_P(GNAFloatMathTest, sgemmMatchesReference) {
+    auto expected = C;
+    ReferenceSgemm(M, N, K, A.data(), K, B.data(), N, expected.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N,
+                 1.0f, C.data(), N);
+    ExpectNear(expected, C, K);
+}
+
+TEST_P(GNAFloatMathTest, sgemmTransposedBMatchesReference) {
+    std::vector<float> Bt(B.size());
+    for (int k = 0; k < K; k++) {
+        for (int n = 0; n < N; n++) {
+            Bt[n * K + k] = B[k * N + n];
+        }
+    }
+    auto expected = C;
+    ReferenceSgemm(M, N, K, A.data(), K, B.data(), N, expected.data(), N);
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasTrans, M, N, K, 1.0f, A.data(), K, Bt.data(), K,
+                 1.0f, C.data(), N);
+    ExpectNear(expected, C, K);
+}
+
+TEST_P(GNAFloatMathTest, sgemmSubsetMatchesReference) {
+    std::vector<uint32_t> rows;
+    for (int i = M - 1; i >= 0; i -= 2) {
+        rows.push_back(i);
+    }
+    std::vector<float> expected(rows.size() * N, 0.0f);
+    for (size_t l = 0; l < rows.size(); l++) {
+        ReferenceSgemm(1, N, K, A.data() + rows[l] * K, K, B.data(), N, expected.data() + l * N, N);
+    }
+    std::vector<float> actual(rows.size() * N, 0.0f);
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N,
+                       1.0f, actual.data(), N, rows.data(), rows.size());
+    ExpectNear(expected, actual, K);
+}
+
+TEST_P(GNAFloatMathTest, affineTransformMatchesReference) {
+    auto bias = RandomVector(M, 4);
+    std::vector<float> expected(M * N);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            expected[i * N + j] = bias[i];
+        }
+    }
+    ReferenceSgemm(M, N, K, A.data(), K, B.data(), N, expected.data(), N);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = K;
+    component.num_columns_in = N;
+    component.num_rows_out = M;
+    component.num_columns_out = N;
+    component.num_bytes_per_input = sizeof(float);
+    component.op.affine.ptr_weights = A.data();
+    component.op.affine.ptr_biases = bias.data();
+    component.ptr_inputs = B.data();
+    component.ptr_outputs = C.data();
+    FP::ApplyAffineTransform(&component, nullptr, 0);
+    ExpectNear(expected, C, K);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAFloatMathTest,
+                        ::testing::Values(GemmShape{1, 1, 1},
+                                          GemmShape{7, 3, 5},
+                                          GemmShape{64, 1, 440},
+                                          GemmShape{33, 8, 257},
+                                          GemmShape{512, 4, 1024}));
+
+TEST(GNAFloatRuntimeTest, convolutionMatchesReference) {
+    const uint32_t num_filters = 6, num_filter_coefficients = 24, num_feature_maps = 2;
+    const uint32_t num_feature_map_columns = 4, num_feature_map_rows = 40, num_filter_rows = 3;
+    const uint32_t band_stride = num_feature_maps * num_feature_map_columns;
+    const uint32_t num_filter_outputs = num_feature_map_rows - num_filter_rows + 1;
+
+    auto inputs = RandomVector(num_feature_map_rows * band_stride + num_filter_coefficients, 1);
+    auto filters = RandomVector(num_filters * num_filter_coefficients, 2);
+    auto biases = RandomVector(num_filters, 3);
+    std::vector<float> outputs(num_filter_outputs * num_filters);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = num_filter_outputs * num_filters;
+    component.op.conv1D.num_filters = num_filters;
+    component.op.conv1D.num_filter_rows = num_filter_rows;
+    component.op.conv1D.num_filter_coefficients = num_filter_coefficients;
+    component.op.conv1D.num_feature_maps = num_feature_maps;
+    component.op.conv1D.num_feature_map_rows = num_feature_map_rows;
+    component.op.conv1D.num_feature_map_columns = num_feature_map_columns;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.original_layer_name = "conv";
+    CNNFilter32(&component);
+
+    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+        for (uint32_t i = 0; i < num_filters; i++) {
+            float expected = biases[i];
+            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
+                expected += inputs[j * band_stride + k] * filters[i * num_filter_coefficients + k];
+            }
+            ASSERT_NEAR(expected, outputs[j * num_filters + i], 1e-5f);
+        }
+    }
+}
+
+TEST(GNAFloatRuntimeTest, DISABLED_sgemmThroughput) {
+    // shape of a large speech model affine layer with a batch of 4 frames
+    const int M = 2048, N = 4, K = 2048, iterations = 50;
+    auto A = RandomVector(M * K, 1);
+    auto B = RandomVector(K * N, 2);
+    std::vector<float> C(M * N, 0.0f);
+
+    auto measure = [&](const std::function<void()> &gemm) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            gemm();
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        auto seconds = std::chrono::duration<double>(finish - start).count();
+        return 2.0 * M * N * K * iterations / seconds * 1e-9;
+    };
+
+    std::cout << "reference sgemm : " << measure([&] {
+        ReferenceSgemm(M, N, K, A.data(), K, B.data(), N, C.data(), N);
+    }) << " GFLOPS" << std::endl;
+    std::cout << "runtime sgemm : " << measure([&] {
+        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N,
+                     1.0f, C.data(), N);
+    }) << " GFLOPS" << std::endl;
+}
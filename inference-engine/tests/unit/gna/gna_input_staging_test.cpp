@@ -0,0 +1,188 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "gna_plugin.hpp"
+#include "preprocessing.hpp"
+
+using GNAPluginNS::GNAPlugin;
+
+namespace {
+
+std::vector<float> RandomFrames(size_t size, float range) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-range, range);
+    std::vector<float> values(size);
+    for (auto &value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+}  // namespace
+
+class GNAPluginForStagingTest : public GNAPlugin {
+ public:
+    using GNAPlugin::ImportFrames;
+    using GNAPlugin::ExportScores;
+};
+
+TEST(GNAInputStagingTest, quantizationMatchesScalarConversion) {
+    auto src = RandomFrames(1003, 40000.0f);
+    // values around the rounding and saturation boundaries
+    const std::vector<float> edges = {0.0f, -0.0f, 0.5f, -0.5f, 1.49f, -1.49f, 32766.5f, 32767.4f, 32767.6f,
+                                      -32767.5f, -32768.4f, -32768.6f, 1e10f, -1e10f,
+                                      std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+    src.insert(src.begin(), edges.begin(), edges.end());
+
+    for (float scaleFactor : {1.0f, 0.75f, 2048.0f}) {
+        std::vector<int16_t> actual(src.size());
+        GNAPluginNS::ConvertFloatToInt16(actual.data(), src.data(), src.size(), scaleFactor);
+        for (size_t i = 0; i < src.size(); i++) {
+            ASSERT_EQ(GNAPluginNS::ConvertFloatToInt16(src[i] * scaleFactor), actual[i])
+                << "value " << src[i] << " scale factor " << scaleFactor;
+        }
+    }
+}
+
+TEST(GNAInputStagingTest, dequantizationMatchesScalarConversion) {
+    const uint32_t rows = 3, columns = 37;
+    const float scaleFactor = 2048.0f;
+    std::vector<int32_t> src(rows * columns);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<int32_t>(i * 7919) - 100000;
+    }
+    std::vector<float> actual(src.size());
+    GNAPluginNS::ConvertToFloat(actual.data(), src.data(), rows, columns, scaleFactor);
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(static_cast<float>(src[i]) / scaleFactor, actual[i]);
+    }
+}
+
+// frames, group, vector elements, vector stride
+typedef std::tuple<uint32_t, uint32_t, uint32_t, uint32_t> StagingShape;
+
+class GNAInterleaveTest : public ::testing::TestWithParam<StagingShape> {
+ protected:
+    void SetUp() override {
+        std::tie(frames, group, elements, stride) = GetParam();
+    }
+
+    uint32_t frames, group, elements, stride;
+    GNAPluginForStagingTest plugin;
+};
+
+TEST_P(GNAInterleaveTest, importFramesInterleaves) {
+    auto src = RandomFrames(frames * elements, 1.0f);
+    std::vector<float> actual(stride * group, -1.0f);
+    plugin.ImportFrames(actual.data(), src.data(), InferenceEngine::Precision::FP32, 1.0f,
+                        kDnnInterleavedOrientation, frames, group, elements, stride);
+    for (uint32_t j = 0; j < stride; j++) {
+        for (uint32_t i = 0; i < group; i++) {
+            const float expected = (i < frames && j < elements) ? src[i * elements + j] : 0.0f;
+            ASSERT_EQ(expected, actual[j * group + i]) << "frame " << i << " element " << j;
+        }
+    }
+}
+
+TEST_P(GNAInterleaveTest, importFramesPadsDeinterleaved) {
+    auto src = RandomFrames(frames * elements, 1.0f);
+    std::vector<float> actual(stride * group, -1.0f);
+    plugin.ImportFrames(actual.data(), src.data(), InferenceEngine::Precision::FP32, 1.0f,
+                        kDnnNonInterleavedOrientation, frames, group, elements, stride);
+    for (uint32_t i = 0; i < group; i++) {
+        for (uint32_t j = 0; j < stride; j++) {
+            const float expected = (i < frames && j < elements) ? src[i * elements + j] : 0.0f;
+            ASSERT_EQ(expected, actual[i * stride + j]) << "frame " << i << " element " << j;
+        }
+    }
+}
+
+TEST_P(GNAInterleaveTest, exportScoresDeinterleaves) {
+    // elements play the role of active elements and stride the one of output vector length
+    std::vector<int16_t> src(elements * group);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<int16_t>(i);
+    }
+    std::vector<int32_t> actual(frames * stride, -1);
+    plugin.ExportScores(actual.data(), src.data(), kDnnInterleavedOrientation, frames, group, stride, elements,
+                        elements, sizeof(int16_t), sizeof(int32_t));
+    for (uint32_t i = 0; i < frames; i++) {
+        for (uint32_t j = 0; j < stride; j++) {
+            const int32_t expected = j < elements ? src[j * group + i] : 0;
+            ASSERT_EQ(expected, actual[i * stride + j]) << "frame " << i << " element " << j;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNAInputStaging, GNAInterleaveTest,
+                        ::testing::Values(StagingShape{1, 1, 1, 8},
+                                          StagingShape{1, 8, 40, 40},
+                                          StagingShape{3, 4, 63, 64},
+                                          StagingShape{8, 8, 440, 448},
+                                          StagingShape{5, 8, 129, 136}));
+
+TEST(GNAInputStagingTest, DISABLED_stagingThroughput) {
+    // a batch of 8 frames of a large speech model input
+    const uint32_t frames = 8, elements = 4096, iterations = 2000;
+    const float scaleFactor = 2048.0f;
+    auto src = RandomFrames(frames * elements, 1.0f);
+    std::vector<int16_t> quantized(frames * elements);
+    std::vector<float> interleaved(frames * elements);
+    std::vector<int32_t> scores(frames * elements);
+    GNAPluginForStagingTest plugin;
+
+    auto measure = [&](const std::function<void()> &staging) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            staging();
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count() / iterations / frames;
+    };
+
+    std::cout << "scalar quantize : " << measure([&] {
+        for (size_t i = 0; i < src.size(); i++) {
+            quantized[i] = GNAPluginNS::ConvertFloatToInt16(src[i] * scaleFactor);
+        }
+    }) << " ns per frame" << std::endl;
+    std::cout << "vector quantize : " << measure([&] {
+        GNAPluginNS::ConvertFloatToInt16(quantized.data(), src.data(), src.size(), scaleFactor);
+    }) << " ns per frame" << std::endl;
+
+    std::cout << "scalar interleave : " << measure([&] {
+        for (uint32_t i = 0; i < frames; i++) {
+            for (uint32_t j = 0; j < elements; j++) {
+                interleaved[j * frames + i] = src[i * elements + j];
+            }
+        }
+    }) << " ns per frame" << std::endl;
+    std::cout << "ImportFrames : " << measure([&] {
+        plugin.ImportFrames(interleaved.data(), src.data(), InferenceEngine::Precision::FP32, 1.0f,
+                            kDnnInterleavedOrientation, frames, frames, elements, elements);
+    }) << " ns per frame" << std::endl;
+
+    std::cout << "scalar export : " << measure([&] {
+        for (uint32_t i = 0; i < frames; i++) {
+            for (uint32_t j = 0; j < elements; j++) {
+                scores[i * elements + j] = quantized[j * frames + i];
+            }
+        }
+    }) << " ns per frame" << std::endl;
+    std::cout << "ExportScores : " << measure([&] {
+        plugin.ExportScores(scores.data(), quantized.data(), kDnnInterleavedOrientation, frames, frames, elements,
+                            elements, elements, sizeof(int16_t), sizeof(int32_t));
+    }) << " ns per frame" << std::endl;
+}
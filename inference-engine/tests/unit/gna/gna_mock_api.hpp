@@ -83,5 +83,8 @@ public:
     MOCK_METHOD2(Gna2RequestWait, Gna2Status(
         uint32_t requestId,
         uint32_t timeoutMilliseconds));
+    MOCK_METHOD2(Gna2DeviceSetNumberOfThreads, Gna2Status(
+        uint32_t deviceIndex,
+        uint32_t numberOfThreads));
 #endif
 };
@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#if GNA_LIB_VER == 2
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "gna_plugin.hpp"
+#include "gna_mock_api.hpp"
+#include <gna/gna_config.hpp>
+
+using GNAPluginNS::GNAPlugin;
+namespace GNAConfigParams = InferenceEngine::GNAConfigParams;
+using ::testing::Return;
+using ::testing::_;
+
+class GNAPluginForParallelRequestsTest : public GNAPlugin {
+ public:
+    explicit GNAPluginForParallelRequestsTest(const std::map<std::string, std::string> &configMap)
+        : GNAPlugin(configMap) {
+        InitGNADevice();
+    }
+};
+
+class GNAParallelRequestsTest : public ::testing::Test {
+};
+
+TEST_F(GNAParallelRequestsTest, softwareEmulationGetsWorkerThreadPerRequest) {
+    GNACppApi enableMocks;
+    EXPECT_CALL(enableMocks, Gna2DeviceSetNumberOfThreads(_, 4)).
+        Times(1).
+        WillOnce(Return(Gna2StatusSuccess));
+    GNAPluginForParallelRequestsTest plugin({{GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_EXACT},
+                                             {GNA_CONFIG_KEY(LIB_N_THREADS), "4"}});
+}
+
+TEST_F(GNAParallelRequestsTest, autoModeWithoutDeviceGetsWorkerThreadPerRequest) {
+    GNACppApi enableMocks;
+    EXPECT_CALL(enableMocks, Gna2DeviceSetNumberOfThreads(_, 2)).
+        Times(1).
+        WillOnce(Return(Gna2StatusSuccess));
+    GNAPluginForParallelRequestsTest plugin({{GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_AUTO},
+                                             {GNA_CONFIG_KEY(LIB_N_THREADS), "2"}});
+}
+
+TEST_F(GNAParallelRequestsTest, hardwareModeKeepsSingleWorkerThread) {
+    GNACppApi enableMocks;
+    EXPECT_CALL(enableMocks, Gna2DeviceSetNumberOfThreads(_, _)).Times(0);
+    GNAPluginForParallelRequestsTest plugin({{GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_HW},
+                                             {GNA_CONFIG_KEY(LIB_N_THREADS), "4"}});
+}
+
+TEST_F(GNAParallelRequestsTest, singleRequestKeepsSingleWorkerThread) {
+    GNACppApi enableMocks;
+    EXPECT_CALL(enableMocks, Gna2DeviceSetNumberOfThreads(_, _)).Times(0);
+    GNAPluginForParallelRequestsTest plugin({{GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_EXACT},
+                                             {GNA_CONFIG_KEY(LIB_N_THREADS), "1"}});
+}
+#endif
@@ -169,6 +169,13 @@ TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsSwFp32Test) {
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_MODE), GNA_CONFIG_VALUE(SW_FP32));
+    SetAndCompare(GNA_CONFIG_KEY(LIB_N_THREADS), "2");
+    EXPECT_EQ(config.gnaFlags.gna_lib_async_threads_num, 2);
+    EXPECT_TRUE(config.gnaFlags.sw_fp32);
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
     SetAndCheckFlag(CONFIG_KEY(SINGLE_THREAD),
                     config.gnaFlags.gna_openmp_multithreading,
@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/pwl.h"
+#include "runtime/pwl_design_cache.hpp"
+
+using GNAPluginNS::runtime::PwlDesignCache;
+
+namespace {
+
+bool SameSegments(const std::vector<gna_pwl_segment_t> &lhs, const std::vector<gna_pwl_segment_t> &rhs) {
+    return lhs.size() == rhs.size() &&
+           std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(gna_pwl_segment_t)) == 0;
+}
+
+DnnActivation PowActivation(float exponent) {
+    auto activation = DnnActivation::fromType(kActPow);
+    activation.args.pow.exponent = exponent;
+    activation.args.pow.scale = 1.0f;
+    activation.args.pow.offset = 0.0f;
+    return activation;
+}
+
+}  // namespace
+
+class GNAPwlDesignCacheTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        PwlDesignCache::instance().clear();
+    }
+    void TearDown() override {
+        PwlDesignCache::instance().clear();
+    }
+};
+
+TEST_F(GNAPwlDesignCacheTest, designMatchesUncachedDesign) {
+    for (auto activation : {DnnActivation::fromType(kActSigmoid), DnnActivation::fromType(kActTanh),
+                            DnnActivation::fromType(kActIdentity), PowActivation(2.0f)}) {
+        std::vector<gna_pwl_segment_t> expected, first, second;
+        PwlDesignOpt16(activation, expected, 2048.0f, 1024.0f);
+        PwlDesignCache::instance().design(activation, first, 2048.0f, 1024.0f);
+        PwlDesignCache::instance().design(activation, second, 2048.0f, 1024.0f);
+        ASSERT_TRUE(SameSegments(expected, first)) << activation.type;
+        ASSERT_TRUE(SameSegments(expected, second)) << activation.type;
+    }
+    ASSERT_EQ(4, PwlDesignCache::instance().size());
+}
+
+TEST_F(GNAPwlDesignCacheTest, keyIncludesScaleFactorsAndArguments) {
+    std::vector<gna_pwl_segment_t> segments;
+    PwlDesignCache::instance().design(DnnActivation::fromType(kActSigmoid), segments, 2048.0f, 1024.0f);
+    PwlDesignCache::instance().design(DnnActivation::fromType(kActSigmoid), segments, 2048.0f, 2048.0f);
+    PwlDesignCache::instance().design(DnnActivation::fromType(kActSigmoid), segments, 1024.0f, 1024.0f);
+    PwlDesignCache::instance().design(PowActivation(2.0f), segments, 2048.0f, 1024.0f);
+    PwlDesignCache::instance().design(PowActivation(0.5f), segments, 2048.0f, 1024.0f);
+    ASSERT_EQ(5, PwlDesignCache::instance().size());
+}
+
+TEST_F(GNAPwlDesignCacheTest, precomputeDesignsDistinctRequestsOnce) {
+    std::vector<PwlDesignCache::Request> requests;
+    for (int i = 0; i < 10; i++) {
+        requests.push_back({DnnActivation::fromType(kActSigmoid), 2048.0f, 1024.0f});
+        requests.push_back({DnnActivation::fromType(kActTanh), 2048.0f, 1024.0f});
+    }
+    auto statistics = PwlDesignCache::instance().precompute(requests);
+    ASSERT_EQ(20, statistics.requested);
+    ASSERT_EQ(2, statistics.designed);
+
+    // second load of the same network finds everything in the cache
+    statistics = PwlDesignCache::instance().precompute(requests);
+    ASSERT_EQ(0, statistics.designed);
+
+    std::vector<gna_pwl_segment_t> expected, actual;
+    PwlDesignOpt16(DnnActivation::fromType(kActTanh), expected, 2048.0f, 1024.0f);
+    PwlDesignCache::instance().design(DnnActivation::fromType(kActTanh), actual, 2048.0f, 1024.0f);
+    ASSERT_TRUE(SameSegments(expected, actual));
+}
+
+TEST_F(GNAPwlDesignCacheTest, DISABLED_designThroughput) {
+    // LSTM like network with sigmoid and tanh gates quantized with a handful of distinct scale factors
+    std::vector<PwlDesignCache::Request> requests;
+    for (int layer = 0; layer < 300; layer++) {
+        const float scale_in = 1024.0f * (1 + layer % 4);
+        requests.push_back({DnnActivation::fromType(layer % 3 ? kActSigmoid : kActTanh), scale_in, 2048.0f});
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto &&request : requests) {
+        std::vector<gna_pwl_segment_t> segments;
+        PwlDesignOpt16(request.activation, segments, request.scale_in, request.scale_out);
+    }
+    auto uncached = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    PwlDesignCache::instance().precompute(requests);
+    for (auto &&request : requests) {
+        std::vector<gna_pwl_segment_t> segments;
+        PwlDesignCache::instance().design(request.activation, segments, request.scale_in, request.scale_out);
+    }
+    auto cached = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "per layer design : " << uncached.count() << " ms" << std::endl;
+    std::cout << "cached design : " << cached.count() << " ms" << std::endl;
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "frontend/quantization.h"
+
+namespace {
+
+std::vector<float> RandomWeights(size_t size, float range) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-range, range);
+    std::vector<float> values(size);
+    for (auto &value : values) {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+float ReferenceMaxAbsValue(const float *ptr, size_t num_elements) {
+    float max = 0.0f;
+    for (size_t i = 0; i < num_elements; i++) {
+        if (fabs(ptr[i]) > max) {
+            max = fabs(ptr[i]);
+        }
+    }
+    return max;
+}
+
+}  // namespace
+
+TEST(GNAQuantizationTest, maxAbsValueMatchesScalarSearch) {
+    // sizes around vector width and parallel chunk boundaries
+    for (size_t size : std::vector<size_t>{1, 3, 4, 7, 17, 1023, 2 * kMaxAbsValueParallelChunk - 1,
+                                          2 * kMaxAbsValueParallelChunk, 3 * kMaxAbsValueParallelChunk + 5}) {
+        auto weights = RandomWeights(size, 3.0f);
+        ASSERT_EQ(ReferenceMaxAbsValue(weights.data(), size), MaxAbsValue(weights.data(), size)) << size;
+
+        // maximum in the scalar tail and in the last chunk
+        weights.back() = -7.5f;
+        ASSERT_EQ(7.5f, MaxAbsValue(weights.data(), size)) << size;
+    }
+}
+
+TEST(GNAQuantizationTest, maxAbsValueSkipsNaN) {
+    auto weights = RandomWeights(2 * kMaxAbsValueParallelChunk + 9, 1.0f);
+    weights[0] = std::numeric_limits<float>::quiet_NaN();
+    weights[5] = std::numeric_limits<float>::quiet_NaN();
+    weights[kMaxAbsValueParallelChunk] = -std::numeric_limits<float>::quiet_NaN();
+    weights.back() = std::numeric_limits<float>::quiet_NaN();
+    weights[10] = -4.0f;
+    ASSERT_EQ(4.0f, MaxAbsValue(weights.data(), weights.size()));
+    ASSERT_EQ(4.0f, MaxAbsValue(weights.data(), 12));
+}
+
+TEST(GNAQuantizationTest, maxAbsValueOfEmptyAndZeroBuffers) {
+    std::vector<float> zeros(100, -0.0f);
+    ASSERT_EQ(0.0f, MaxAbsValue(zeros.data(), 0));
+    ASSERT_EQ(0.0f, MaxAbsValue(zeros.data(), zeros.size()));
+    ASSERT_EQ(-1.0f, ScaleFactorForQuantization(zeros.data(), MAX_VAL_2B_WEIGHT, zeros.size()));
+}
+
+TEST(GNAQuantizationTest, scaleFactorForQuantizationUsesMaxAbsValue) {
+    auto weights = RandomWeights(1000, 0.5f);
+    weights[123] = -2.0f;
+    ASSERT_EQ(MAX_VAL_2B_WEIGHT / 2.0f, ScaleFactorForQuantization(weights.data(), MAX_VAL_2B_WEIGHT, weights.size()));
+}
+
+TEST(GNAQuantizationTest, DISABLED_maxAbsValueThroughput) {
+    // weights of a large TDNN affine layer
+    const auto weights = RandomWeights(64 << 20, 1.0f);
+
+    auto start = std::chrono::steady_clock::now();
+    auto reference = ReferenceMaxAbsValue(weights.data(), weights.size());
+    auto scalar = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    auto actual = MaxAbsValue(weights.data(), weights.size());
+    auto vectorized = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(reference, actual);
+    std::cout << "scalar search : " << scalar.count() << " ms" << std::endl;
+    std::cout << "MaxAbsValue : " << vectorized.count() << " ms" << std::endl;
+}
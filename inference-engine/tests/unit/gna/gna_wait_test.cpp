@@ -15,6 +15,7 @@
 
 using GNAPluginNS::GNAPlugin;
 using GNAPluginNS::GNAInferRequest;
+using ::testing::InSequence;
 using ::testing::Return;
 using ::testing::_;
 
@@ -36,6 +37,20 @@ class GNAPluginForGNAWaitTest : public GNAPlugin {
     }
 };
 
+class GNAPluginForGNAParallelWaitTest : public GNAPluginForGNAWaitTest {
+ public:
+    // two requests are in flight with the library request ids given
+    GNAPluginForGNAParallelWaitTest(uint32_t firstRequestId, uint32_t secondRequestId) {
+        std::get<1>(gnaRequestConfigToRequestIdMap[0]) = firstRequestId;
+        gnaRequestConfigToRequestIdMap.push_back(
+            std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>{ 1, secondRequestId, {} });
+    }
+
+    int64_t RequestId(uint32_t requestIdx) const {
+        return std::get<1>(gnaRequestConfigToRequestIdMap[requestIdx]);
+    }
+};
+
 class GNAInferRequestForGNAWaitTest : public GNAInferRequest {
  public:
     // Prepare underlining object to enable Wait() working
@@ -66,4 +81,33 @@ TEST_F(GNAWaitTest, ReturnsGna2StatusWarningDeviceBusy) {
     GNAInferRequestForGNAWaitTest inferRequest{ plugin };
     ASSERT_EQ(InferenceEngine::RESULT_NOT_READY, inferRequest.Wait(0));
 }
+
+TEST_F(GNAWaitTest, WaitsForInFlightRequestsOutOfOrder) {
+    GNACppApi enableMocks;
+    {
+        InSequence order;
+        EXPECT_CALL(enableMocks, Gna2RequestWait(8, _)).
+            Times(1).
+            WillOnce(Return(Gna2StatusWarningDeviceBusy));
+        EXPECT_CALL(enableMocks, Gna2RequestWait(8, _)).
+            Times(1).
+            WillOnce(Return(Gna2StatusSuccess));
+        EXPECT_CALL(enableMocks, Gna2RequestWait(7, _)).
+            Times(1).
+            WillOnce(Return(Gna2StatusSuccess));
+    }
+    GNAPluginForGNAParallelWaitTest plugin{ 7, 8 };
+
+    ASSERT_EQ(GNA_REQUEST_PENDING, plugin.WaitFor(1, 0));
+    ASSERT_EQ(8, plugin.RequestId(1));
+    ASSERT_EQ(GNA_REQUEST_COMPLETED, plugin.WaitFor(1, 0));
+    // the later request is given back alone, the earlier one is still in flight
+    ASSERT_EQ(-1, plugin.RequestId(1));
+    ASSERT_EQ(7, plugin.RequestId(0));
+
+    ASSERT_EQ(GNA_REQUEST_COMPLETED, plugin.WaitFor(0, 0));
+    ASSERT_EQ(-1, plugin.RequestId(0));
+    // synced requests do not reach the library again
+    ASSERT_EQ(GNA_REQUEST_COMPLETED, plugin.WaitFor(1, 0));
+}
 #endif
@@ -0,0 +1,250 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "multi_device_exec_network.hpp"
+
+using MultiDevicePlugin::ThreadSafeBoundedQueue;
+
+namespace {
+
+struct Item {
+    std::atomic<bool> owned = {false};
+};
+
+// the same pattern as the idle worker requests: every thread takes an item, owns it exclusively for a while and returns it
+template <typename Queue>
+std::size_t RunPool(Queue& queue, std::vector<Item>& items, int numThreads, std::chrono::milliseconds duration,
+                    std::atomic<int>& numErrors, bool holdItems = true) {
+    for (auto&& item : items) {
+        EXPECT_TRUE(queue.try_push(&item));
+    }
+    std::atomic<bool> stop = {false};
+    std::atomic<std::size_t> numIterations = {0};
+    std::vector<std::thread> threads;
+    for (int threadInd = 0; threadInd < numThreads; ++threadInd) {
+        threads.emplace_back([&] {
+            std::size_t localIterations = 0;
+            while (!stop.load()) {
+                Item* item = nullptr;
+                if (!queue.try_pop(item)) {
+                    continue;
+                }
+                if (item->owned.exchange(true)) {
+                    ++numErrors;
+                }
+                if (holdItems) {
+                    std::this_thread::yield();
+                }
+                item->owned.store(false);
+                if (!queue.try_push(item)) {
+                    ++numErrors;
+                }
+                ++localIterations;
+            }
+            numIterations += localIterations;
+        });
+    }
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    return numIterations;
+}
+
+template <typename T>
+class MutexBoundedQueue {
+public:
+    bool try_push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.size() >= _capacity) {
+            return false;
+        }
+        _queue.push(std::move(value));
+        return true;
+    }
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty()) {
+            return false;
+        }
+        value = std::move(_queue.front());
+        _queue.pop();
+        return true;
+    }
+    void set_capacity(std::size_t newCapacity) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _capacity = newCapacity;
+    }
+
+protected:
+    std::queue<T>   _queue;
+    std::mutex      _mutex;
+    std::size_t     _capacity = 0;
+};
+
+template <typename T>
+class InspectedBoundedQueue : public ThreadSafeBoundedQueue<T> {
+public:
+    std::pair<std::size_t, std::size_t> positions() const {
+        return {this->_enqueuePos.load(), this->_dequeuePos.load()};
+    }
+};
+
+}  // namespace
+
+TEST(MultiDeviceBoundedQueueTests, keepsFifoOrderAndCapacity) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(4);
+    for (int value = 0; value < 4; ++value) {
+        ASSERT_TRUE(queue.try_push(value));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+
+    // wrap around the ring a few times
+    for (int value = 0; value < 16; ++value) {
+        int popped = -1;
+        ASSERT_TRUE(queue.try_pop(popped));
+        ASSERT_EQ(value, popped);
+        ASSERT_TRUE(queue.try_push(value + 4));
+    }
+}
+
+TEST(MultiDeviceBoundedQueueTests, zeroCapacityStopsAcceptingValues) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(2);
+    ASSERT_TRUE(queue.try_push(0));
+    queue.set_capacity(0);
+    ASSERT_FALSE(queue.try_push(1));
+}
+
+TEST(MultiDeviceBoundedQueueTests, itemsAreOwnedExclusivelyUnderContention) {
+    const int numThreads = 2 * std::max(2u, std::thread::hardware_concurrency());
+    std::vector<Item> items(4);
+    ThreadSafeBoundedQueue<Item*> queue;
+    queue.set_capacity(items.size());
+
+    std::atomic<int> numErrors = {0};
+    auto numIterations = RunPool(queue, items, numThreads, std::chrono::milliseconds(500), numErrors);
+    ASSERT_EQ(0, numErrors.load());
+    ASSERT_GT(numIterations, 0u);
+
+    // every item is back in the queue and nothing else is
+    std::vector<bool> popped(items.size(), false);
+    for (std::size_t ind = 0; ind < items.size(); ++ind) {
+        Item* item = nullptr;
+        ASSERT_TRUE(queue.try_pop(item));
+        ASSERT_FALSE(popped[item - items.data()]);
+        popped[item - items.data()] = true;
+    }
+    Item* item = nullptr;
+    ASSERT_FALSE(queue.try_pop(item));
+}
+
+TEST(MultiDeviceBoundedQueueTests, zeroCapacityDuringUseStopsReturningItems) {
+    const int numThreads = 2 * std::max(2u, std::thread::hardware_concurrency());
+    std::vector<Item> items(8);
+    ThreadSafeBoundedQueue<Item*> queue;
+    queue.set_capacity(items.size());
+    for (auto&& item : items) {
+        ASSERT_TRUE(queue.try_push(&item));
+    }
+
+    // as in the executable network destructor, the queue is stopped while the workers still try to return the items
+    std::atomic<int> numErrors = {0};
+    std::atomic<bool> stopped = {false};
+    std::vector<std::thread> threads;
+    for (int threadInd = 0; threadInd < numThreads; ++threadInd) {
+        threads.emplace_back([&] {
+            for (int iteration = 0; iteration < 100000; ++iteration) {
+                const bool stoppedBefore = stopped.load();
+                Item* item = nullptr;
+                if (!queue.try_pop(item)) {
+                    continue;
+                }
+                if (item->owned.exchange(true)) {
+                    ++numErrors;
+                }
+                item->owned.store(false);
+                if (!queue.try_push(item)) {
+                    // the item is dropped as the idle request is dropped by IdleGuard
+                    return;
+                } else if (stoppedBefore) {
+                    ++numErrors;
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.set_capacity(0);
+    stopped = true;
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(0, numErrors.load());
+}
+
+TEST(MultiDeviceBoundedQueueTests, zeroCapacityWaitsForCallsInProgress) {
+    const int numThreads = 2 * std::max(2u, std::thread::hardware_concurrency());
+    std::vector<Item> items(8);
+    InspectedBoundedQueue<Item*> queue;
+    queue.set_capacity(items.size());
+    for (auto&& item : items) {
+        ASSERT_TRUE(queue.try_push(&item));
+    }
+
+    std::atomic<bool> stopped = {false};
+    std::vector<std::thread> threads;
+    for (int threadInd = 0; threadInd < numThreads; ++threadInd) {
+        threads.emplace_back([&] {
+            while (!stopped.load()) {
+                Item* item = nullptr;
+                if (queue.try_pop(item)) {
+                    queue.try_push(item);
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.set_capacity(0);
+    // the threads keep calling, but no call moves the positions once the queue is stopped
+    const auto positions = queue.positions();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    stopped = true;
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(positions, queue.positions());
+}
+
+TEST(MultiDeviceBoundedQueueTests, DISABLED_throughputAgainstMutexQueue) {
+    const auto duration = std::chrono::milliseconds(1000);
+    for (int numThreads : {1, 2, 4, 8, 16}) {
+        std::vector<Item> items(4);
+        std::atomic<int> numErrors = {0};
+
+        ThreadSafeBoundedQueue<Item*> lockFreeQueue;
+        lockFreeQueue.set_capacity(items.size());
+        auto lockFree = RunPool(lockFreeQueue, items, numThreads, duration, numErrors, false);
+
+        MutexBoundedQueue<Item*> mutexQueue;
+        mutexQueue.set_capacity(items.size());
+        auto locked = RunPool(mutexQueue, items, numThreads, duration, numErrors, false);
+
+        ASSERT_EQ(0, numErrors.load());
+        std::cout << numThreads << " threads : ThreadSafeBoundedQueue " << lockFree / duration.count()
+                  << " pop/push per ms, mutex queue " << locked / duration.count() << " pop/push per ms" << std::endl;
+    }
+}
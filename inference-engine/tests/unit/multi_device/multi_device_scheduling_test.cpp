@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <multi-device/multi_device_config.hpp>
+
+#include "unit_test_utils/mocks/mock_iexecutable_network.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+
+#include "multi_device_exec_network.hpp"
+
+using testing::_;
+using testing::DoAll;
+using testing::NiceMock;
+using testing::Return;
+using testing::SetArgReferee;
+
+using namespace MultiDevicePlugin;
+
+class MultiDeviceSchedulingTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (auto&& device : deviceNames) {
+            mockRequests[device] = std::make_shared<NiceMock<MockIInferRequest>>();
+        }
+    }
+
+    MultiDeviceExecutableNetwork::Ptr CreateExecutableNetwork(const std::string& policy) {
+        DeviceMap<InferenceEngine::ExecutableNetwork> networks;
+        std::vector<DeviceInformation> devices;
+        for (auto&& device : deviceNames) {
+            // a single worker request per device, so a busy device is skipped by the scheduler
+            auto mockExeNet = std::make_shared<NiceMock<MockIExecutableNetwork>>();
+            ON_CALL(*mockExeNet, GetMetric(_, _, _))
+                .WillByDefault(DoAll(SetArgReferee<1>(Parameter{1u}), Return(StatusCode::OK)));
+            ON_CALL(*mockExeNet, CreateInferRequest(_, _))
+                .WillByDefault(DoAll(SetArgReferee<0>(IInferRequest::Ptr{mockRequests[device]}), Return(StatusCode::OK)));
+            networks.emplace(device, InferenceEngine::ExecutableNetwork{mockExeNet});
+            devices.push_back({device, {}, -1});
+        }
+        return std::make_shared<MultiDeviceExecutableNetwork>(networks, devices,
+            std::unordered_map<std::string, Parameter>{{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, policy}});
+    }
+
+    static std::string ScheduledDevice(MultiDeviceExecutableNetwork& network) {
+        MultiDeviceExecutableNetwork::WorkerInferRequest* workerRequestPtr = nullptr;
+        network.ScheduleToWorkerInferRequest([&] {
+            workerRequestPtr = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
+        });
+        for (auto&& workerRequests : network._workerRequests) {
+            for (auto&& workerRequest : workerRequests.second) {
+                if (&workerRequest == workerRequestPtr) {
+                    return workerRequests.first;
+                }
+            }
+        }
+        return {};
+    }
+
+    // the first device has the highest priority
+    const std::vector<std::string> deviceNames = {"A", "B"};
+    std::map<std::string, std::shared_ptr<NiceMock<MockIInferRequest>>> mockRequests;
+};
+
+TEST_F(MultiDeviceSchedulingTests, priorityOrderSchedulesToFirstIdleDevice) {
+    auto network = CreateExecutableNetwork(MultiDeviceConfigParams::MULTI_PRIORITY_ORDER);
+    network->_deviceStatistics["A"]._latencyEwmaMs = 10.0;
+    network->_deviceStatistics["B"]._latencyEwmaMs = 1.0;
+
+    ASSERT_EQ("A", ScheduledDevice(*network));
+    ASSERT_EQ("B", ScheduledDevice(*network));
+    // no idle requests left, the task waits in the queue
+    ASSERT_EQ("", ScheduledDevice(*network));
+}
+
+TEST_F(MultiDeviceSchedulingTests, lowestCompletionTimeSchedulesToFasterDevice) {
+    auto network = CreateExecutableNetwork(MultiDeviceConfigParams::MULTI_LOWEST_COMPLETION_TIME);
+    network->_deviceStatistics["A"]._latencyEwmaMs = 10.0;
+    network->_deviceStatistics["B"]._latencyEwmaMs = 1.0;
+
+    ASSERT_EQ("B", ScheduledDevice(*network));
+    // the faster device is busy, so the task goes to the slower one rather than waiting
+    ASSERT_EQ("A", ScheduledDevice(*network));
+}
+
+TEST_F(MultiDeviceSchedulingTests, startedRequestIsInFlightUntilCompletion) {
+    auto network = CreateExecutableNetwork(MultiDeviceConfigParams::MULTI_LOWEST_COMPLETION_TIME);
+    auto& deviceStatistics = network->_deviceStatistics["A"];
+
+    ASSERT_NO_THROW(MultiDeviceExecutableNetwork::StartWorkerInferRequest(&network->_workerRequests["A"].front(), [] {}));
+    ASSERT_EQ(1u, deviceStatistics._numInFlight.load());
+    ASSERT_EQ(1u, deviceStatistics._numDispatched.load());
+
+    deviceStatistics.OnComplete(1.0);
+    ASSERT_EQ(0u, deviceStatistics._numInFlight.load());
+    ASSERT_EQ(1.0, deviceStatistics._latencyEwmaMs.load());
+}
+
+TEST_F(MultiDeviceSchedulingTests, failedStartDoesNotStarveDevice) {
+    ON_CALL(*mockRequests["A"], StartAsync(_)).WillByDefault(Return(StatusCode::GENERAL_ERROR));
+    auto network = CreateExecutableNetwork(MultiDeviceConfigParams::MULTI_LOWEST_COMPLETION_TIME);
+    network->_deviceStatistics["A"]._latencyEwmaMs = 1.0;
+    network->_deviceStatistics["B"]._latencyEwmaMs = 1.5;
+
+    ASSERT_THROW(MultiDeviceExecutableNetwork::StartWorkerInferRequest(&network->_workerRequests["A"].front(), [] {}),
+                 InferenceEngine::details::InferenceEngineException);
+    ASSERT_EQ(0u, network->_deviceStatistics["A"]._numInFlight.load());
+    ASSERT_EQ(0u, network->_deviceStatistics["A"]._numDispatched.load());
+
+    // the request that failed to start does not make the device look busy
+    ASSERT_EQ("A", ScheduledDevice(*network));
+}
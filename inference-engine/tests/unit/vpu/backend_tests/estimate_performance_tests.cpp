@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/allocator/allocator.hpp>
+
+namespace vpu {
+
+class EstimatePerformanceTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _testModel = CreateTestModel();
+
+        const DataDesc desc{1024};
+
+        _testModel.createInputs({desc});
+        _testModel.createOutputs({desc});
+
+        _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(desc)});
+        _testModel.addStage({InputInfo::fromPrevStage(0)}, {OutputInfo::intermediate(desc)});
+        _testModel.addStage({InputInfo::fromPrevStage(1)}, {OutputInfo::fromNetwork()});
+
+        const auto result = runAllocator(_testModel.getBaseModel(), EnableShapeAllocation::YES);
+        ASSERT_EQ(AllocationStatus::OK, result.status);
+    }
+
+protected:
+    TestModel _testModel;
+};
+
+TEST_F(EstimatePerformanceTests, ModelEstimateSumsStageEstimates) {
+    const auto estimate = backEnd->estimatePerformance(_testModel.getBaseModel());
+
+    ASSERT_EQ(3u, estimate.stages.size());
+
+    double latencyUs = 0.0;
+    std::int64_t ddrBytes = 0;
+    for (const auto& stage : estimate.stages) {
+        ASSERT_GT(stage.computeUs, 0.0);
+        ASSERT_GT(stage.ddrBytes, 0);
+        ASSERT_GE(stage.latencyUs, std::max(stage.computeUs, stage.dmaUs));
+
+        latencyUs += stage.latencyUs;
+        ddrBytes += stage.ddrBytes;
+    }
+
+    ASSERT_DOUBLE_EQ(latencyUs, estimate.latencyUs);
+    ASSERT_EQ(ddrBytes, estimate.ddrBytes);
+    ASSERT_GT(estimate.throughputFps, 0.0);
+    ASSERT_GT(estimate.ddrBandwidthGBs, 0.0);
+}
+
+TEST_F(EstimatePerformanceTests, MoreSHAVEsReduceComputeTime) {
+    const auto& model = _testModel.getBaseModel();
+    const auto& stage = _testModel.getStages()[1];
+
+    const auto numSHAVEs = model->attrs().get<Resources>("resources").numSHAVEs;
+    ASSERT_GT(numSHAVEs, 1);
+
+    stage->setNumSHAVEs(1);
+    const auto singleShave = backEnd->estimatePerformance(model);
+
+    stage->setNumSHAVEs(numSHAVEs);
+    const auto allShaves = backEnd->estimatePerformance(model);
+
+    ASSERT_EQ(1, singleShave.stages[1].numSHAVEs);
+    ASSERT_EQ(numSHAVEs, allShaves.stages[1].numSHAVEs);
+    ASSERT_LT(allShaves.stages[1].computeUs, singleShave.stages[1].computeUs);
+    ASSERT_EQ(singleShave.stages[1].ddrBytes, allShaves.stages[1].ddrBytes);
+}
+
+}  // namespace vpu
@@ -0,0 +1,193 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+class PassManagerTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _testModel = CreateTestModel();
+    }
+
+protected:
+    TestModel _testModel;
+};
+
+TEST_F(PassManagerTests, PassSetReportsStatisticsOfEachPass) {
+    const DataDesc desc{1};
+
+    _testModel.createInputs({desc});
+    _testModel.createOutputs({desc});
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(desc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0)}, {OutputInfo::fromNetwork()});
+
+    PassSet pipeline;
+    pipeline.addPass(passManager->initialCheck(), "initialCheck");
+    pipeline.addPass(passManager->markFastStages(), "markFastStages");
+
+    std::vector<PassStatistics> statistics;
+    ASSERT_NO_THROW(statistics = pipeline.run(_testModel.getBaseModel()));
+
+    ASSERT_EQ(2u, statistics.size());
+    ASSERT_EQ("initialCheck", statistics[0].name);
+    ASSERT_EQ("markFastStages", statistics[1].name);
+
+    for (const auto& pass : statistics) {
+        ASSERT_GE(pass.durationMs, 0.0);
+        ASSERT_EQ(2, pass.numStages);
+        ASSERT_EQ(_testModel.getBaseModel()->numDatas(), pass.numDatas);
+    }
+}
+
+TEST_F(PassManagerTests, StageOrderOfLongChainFollowsDataFlow) {
+    const DataDesc desc{1};
+    const int numStages = 20000;
+
+    _testModel.createInputs({desc});
+    _testModel.createOutputs({desc});
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(desc)});
+    for (int stageInd = 1; stageInd < numStages - 1; ++stageInd) {
+        _testModel.addStage({InputInfo::fromPrevStage(stageInd - 1)}, {OutputInfo::intermediate(desc)});
+    }
+    _testModel.addStage({InputInfo::fromPrevStage(numStages - 2)}, {OutputInfo::fromNetwork()});
+
+    int expectedInd = 0;
+    for (const auto& stage : _testModel.getBaseModel()->getStages()) {
+        ASSERT_EQ(expectedInd, stage->attrs().get<int>("test_ind"));
+        ASSERT_EQ(expectedInd, stage->index());
+        ++expectedInd;
+    }
+    ASSERT_EQ(numStages, expectedInd);
+}
+
+TEST_F(PassManagerTests, StageOrderOfBranchesFollowsStageIds) {
+    const DataDesc desc{1};
+
+    _testModel.createInputs({desc});
+    _testModel.createOutputs({desc});
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(desc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0)}, {OutputInfo::intermediate(desc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0)}, {OutputInfo::intermediate(desc)});
+    _testModel.addStage({InputInfo::fromPrevStage(1), InputInfo::fromPrevStage(2)}, {OutputInfo::fromNetwork()});
+
+    const auto stageTestInds = [this]() {
+        std::vector<int> testInds;
+        for (const auto& stage : _testModel.getBaseModel()->getStages()) {
+            testInds.push_back(stage->attrs().get<int>("test_ind"));
+        }
+        return testInds;
+    };
+
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), stageTestInds());
+
+    // Comparator changes the order of next stages
+    _testModel.getBaseModel()->reorderStages([](const Stage& left, const Stage& right) {
+        return left->id() > right->id();
+    });
+
+    ASSERT_EQ((std::vector<int>{0, 2, 1, 3}), stageTestInds());
+}
+
+//
+// Compile time of the HW convolution tiling over a set of synthetic models
+//
+
+class PassManagerCompileTimeTests : public GraphTransformerTest {
+protected:
+    struct ConvBlock final {
+        int width;
+        int height;
+        int channels;
+        int kernelSize;
+        int numLayers;
+    };
+
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    Model CreateConvModel(const std::string& name, const ConvBlock& block) {
+        auto model = CreateModel();
+
+        const DataDesc desc(DataType::FP16, DimsOrder::NCHW, {block.width, block.height, block.channels, 1});
+
+        auto input = model->addInputData(name + "@input", desc);
+        model->attrs().set<int>("numInputs", 1);
+        auto output = model->addOutputData(name + "@output", desc);
+        model->attrs().set<int>("numOutputs", 1);
+
+        const auto pad = block.kernelSize / 2;
+        for (int layerInd = 0; layerInd < block.numLayers; ++layerInd) {
+            const auto layerName = formatString("%s@conv%d", name, layerInd);
+
+            auto conv = std::make_shared<ie::ConvolutionLayer>(ie::LayerParams{layerName, "Convolution", ie::Precision::FP16});
+            conv->_kernel_x = block.kernelSize;
+            conv->_kernel_y = block.kernelSize;
+            conv->_stride_x = 1;
+            conv->_stride_y = 1;
+            conv->_dilation_x = 1;
+            conv->_dilation_y = 1;
+            conv->_padding.insert(0, pad);
+            conv->_padding.insert(1, pad);
+            conv->_pads_end.insert(0, pad);
+            conv->_pads_end.insert(1, pad);
+
+            conv->_weights = ie::make_shared_blob<short>({
+                ie::Precision::FP16,
+                {static_cast<size_t>(block.kernelSize * block.kernelSize * block.channels * block.channels)},
+                ie::Layout::C});
+            conv->_weights->allocate();
+
+            auto layerOutput = layerInd + 1 == block.numLayers ? output : model->addNewData(layerName, desc);
+            frontEnd->parseConvolution(model, conv, {input}, {layerOutput});
+            input = layerOutput;
+        }
+
+        return model;
+    }
+};
+
+TEST_F(PassManagerCompileTimeTests, DISABLED_HwConvTilingOverModelZoo) {
+    const std::vector<std::pair<std::string, ConvBlock>> zoo = {
+        {"resnet-like-56x56", {56, 56, 64, 3, 32}},
+        {"resnet-like-28x28", {28, 28, 128, 3, 32}},
+        {"resnet-like-14x14", {14, 14, 256, 3, 32}},
+        {"mobilenet-like-112x112", {112, 112, 32, 1, 32}},
+        {"detector-like-300x300", {300, 300, 32, 3, 16}},
+    };
+
+    for (const auto& entry : zoo) {
+        auto model = CreateConvModel(entry.first, entry.second);
+
+        PassSet pipeline;
+        pipeline.addPass(passManager->hwPadding(), "hwPadding");
+        pipeline.addPass(passManager->hwConvTiling(), "hwConvTiling");
+
+        std::vector<PassStatistics> statistics;
+        ASSERT_NO_THROW(statistics = pipeline.run(model));
+
+        for (const auto& pass : statistics) {
+            std::cout << entry.first << " : " << pass.name << " : " << pass.durationMs << " ms, "
+                      << pass.numStages << " stages" << std::endl;
+        }
+    }
+}
+
+} // namespace vpu
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/allocator/allocator.hpp>
+
+namespace vpu {
+
+class AllocateResourcesTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _testModel = CreateTestModel();
+    }
+
+    int AllocateBSS(bool enableBssIntervalPacking) {
+        config.enableBssIntervalPacking = enableBssIntervalPacking;
+        CompileEnv::updateConfig(config);
+
+        const auto& model = _testModel.getBaseModel();
+
+        const auto result = runAllocator(model, EnableShapeAllocation::YES);
+        EXPECT_EQ(AllocationStatus::OK, result.status);
+
+        return model->getAllocator().usedMemoryAmount().BSS;
+    }
+
+    static bool Overlap(const Data& left, const Data& right) {
+        const auto leftOffset = left->dataLocation().offset;
+        const auto rightOffset = right->dataLocation().offset;
+        return leftOffset < rightOffset + calcAllocationSize(right) && rightOffset < leftOffset + calcAllocationSize(left);
+    }
+
+protected:
+    TestModel _testModel;
+};
+
+TEST_F(AllocateResourcesTests, BssIntervalPackingRemovesFragmentation) {
+    const DataDesc bigDesc{64};
+    const DataDesc smallDesc{32};
+
+    _testModel.createInputs({bigDesc});
+    _testModel.createOutputs({bigDesc});
+
+    //
+    // Greedy allocation places the second small data to the end of the freed big one,
+    // so the last big data doesn't fit into the free space left in front of it
+    //
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(bigDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0)}, {OutputInfo::intermediate(smallDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(1)}, {OutputInfo::intermediate(smallDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(2)}, {OutputInfo::intermediate(bigDesc)});
+    _testModel.addStage({InputInfo::fromPrevStage(3)}, {OutputInfo::fromNetwork()});
+
+    const auto& stages = _testModel.getStages();
+    const auto bigSize = calcAllocationSize(stages[0]->output(0));
+    const auto smallSize = calcAllocationSize(stages[1]->output(0));
+
+    ASSERT_EQ(2 * bigSize, AllocateBSS(false));
+    ASSERT_EQ(bigSize + smallSize, AllocateBSS(true));
+
+    for (int stageInd = 1; stageInd < 4; ++stageInd) {
+        const auto& input = stages[stageInd]->input(0);
+        const auto& output = stages[stageInd]->output(0);
+
+        ASSERT_EQ(Location::BSS, input->dataLocation().location);
+        ASSERT_EQ(Location::BSS, output->dataLocation().location);
+        ASSERT_FALSE(Overlap(input, output)) << input->name() << " and " << output->name();
+    }
+}
+
+TEST_F(AllocateResourcesTests, BssIntervalPackingKeepsOptimalGreedyAllocation) {
+    const DataDesc desc{64};
+
+    _testModel.createInputs({desc});
+    _testModel.createOutputs({desc});
+
+    _testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::intermediate(desc)});
+    _testModel.addStage({InputInfo::fromPrevStage(0)}, {OutputInfo::intermediate(desc)});
+    _testModel.addStage({InputInfo::fromPrevStage(1)}, {OutputInfo::fromNetwork()});
+
+    const auto& stages = _testModel.getStages();
+
+    const auto greedyBSS = AllocateBSS(false);
+    const auto greedyOffset = stages[1]->output(0)->dataLocation().offset;
+
+    ASSERT_EQ(greedyBSS, AllocateBSS(true));
+    ASSERT_EQ(greedyOffset, stages[1]->output(0)->dataLocation().offset);
+}
+
+}  // namespace vpu
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <string>
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+class HwConvTilingTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        // the checks of the cache hits must not depend on the tests run before
+        HWTilingNS::resetTilingOptionsCache();
+    }
+
+    void EnableDmaCost(bool enable) {
+        config.hwConvTilingDmaCost = enable;
+        CompileEnv::updateConfig(config);
+    }
+
+    static HWTilingNS::HWConvolutionTiler CreateTiler(const std::string& name, int size, int channels) {
+        const auto dims = DataDesc(DataType::FP16, DimsOrder::NCHW, {size, size, channels, 1}).dims();
+
+        return HWTilingNS::HWConvolutionTiler(
+            HWTilingNS::ConvolutionOptions{name, dims, dims, dims, 3, 3, 1, 1, 1, 1, 1, false},
+            HWTilingNS::Direction::INPUT_TO_OUTPUT,
+            1);
+    }
+};
+
+TEST_F(HwConvTilingTests, StagesOfSameShapeGetSameTiling) {
+    const auto first = CreateTiler("first", 112, 64);
+    const auto second = CreateTiler("second", 112, 64);
+
+    ASSERT_TRUE(first.isTilingPossible());
+    ASSERT_TRUE(second.isTilingPossible());
+    ASSERT_TRUE(second.tilingOptionsFromCache());
+    ASSERT_EQ(first.tilingOptions().size(), second.tilingOptions().size());
+
+    for (size_t ind = 0; ind < first.tilingOptions().size(); ++ind) {
+        const auto& firstOption = first.tilingOptions()[ind];
+        const auto& secondOption = second.tilingOptions()[ind];
+
+        ASSERT_EQ(firstOption.numWidthTiles, secondOption.numWidthTiles);
+        ASSERT_EQ(firstOption.numHeightTiles, secondOption.numHeightTiles);
+        ASSERT_EQ(firstOption.numChannelTiles, secondOption.numChannelTiles);
+        ASSERT_EQ(firstOption.cost, secondOption.cost);
+    }
+}
+
+TEST_F(HwConvTilingTests, DmaCostIsDisabledByDefault) {
+    ASSERT_FALSE(config.hwConvTilingDmaCost);
+
+    const auto withoutDmaCost = CreateTiler("withoutDmaCost", 200, 64);
+
+    ASSERT_NO_FATAL_FAILURE(EnableDmaCost(true));
+    const auto withDmaCost = CreateTiler("withDmaCost", 200, 64);
+
+    ASSERT_TRUE(withoutDmaCost.isTilingPossible());
+    ASSERT_TRUE(withDmaCost.isTilingPossible());
+    // the options of the other cost model are not reused
+    ASSERT_FALSE(withDmaCost.tilingOptionsFromCache());
+    // the DMA terms only add to the cost of every tiling
+    ASSERT_GE(withDmaCost.tilingOptions().front().cost, withoutDmaCost.tilingOptions().front().cost);
+}
+
+TEST_F(HwConvTilingTests, CostModelCountsWeightsReloadsOfPlaneTiles) {
+    const int size = 300;
+    const int channels = 64;
+
+    ASSERT_NO_FATAL_FAILURE(EnableDmaCost(true));
+    const auto tiler = CreateTiler("large", size, channels);
+
+    ASSERT_TRUE(tiler.isTilingPossible());
+    ASSERT_FALSE(tiler.tilingOptions().empty());
+
+    const auto& option = tiler.tilingOptions().front();
+    ASSERT_DOUBLE_EQ(option.costTerms.total(), option.cost);
+    ASSERT_GT(option.costTerms.hwOps, 0.0);
+
+    const auto& hwTiling = tiler.getHwTilings().front();
+    const auto numPlaneTiles = hwTiling->sohTiles * hwTiling->sowTiles;
+    ASSERT_GT(numPlaneTiles, 1);
+
+    const double weightsBytes = 2.0 * 3 * 3 * channels * channels;
+    ASSERT_GE(option.costTerms.dmaBytes, (numPlaneTiles - 1) * weightsBytes);
+}
+
+}  // namespace vpu
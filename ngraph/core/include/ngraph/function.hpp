@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -31,6 +32,22 @@
 
 namespace ngraph
 {
+    /// \brief Topological order of the function ops. It is shared with the ops themselves, so
+    ///        any change of their inputs or control dependencies drops the cached order.
+    class OrderedOpsCache
+    {
+    public:
+        void invalidate() { m_valid = false; }
+        bool is_valid() const { return m_valid; }
+    private:
+        friend class Function;
+
+        std::atomic<bool> m_valid{false};
+        std::mutex m_mutex;
+        // Ops are not owned by the cache, so the ops removed from the graph are released as usual
+        std::vector<std::weak_ptr<Node>> m_ordered_ops;
+    };
+
     /// A user-defined function.
     class NGRAPH_API Function
     {
@@ -109,6 +126,11 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Validates just the nodes which need it after the function was changed, see
+        ///        Node::needs_revalidation(). TensorIterator and Loop ops are always validated, as
+        ///        their bodies may be changed without marking the ops.
+        void validate_changed_nodes_and_infer_types();
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -170,12 +192,20 @@ namespace ngraph
         /// \param result Result node to delete
         void remove_result(const std::shared_ptr<op::Result>& result);
 
+        /// \brief Cached topological order of the function ops. The ops refer to it weakly, so it
+        ///        is released together with the function.
+        const std::shared_ptr<OrderedOpsCache>& get_ordered_ops_cache() const
+        {
+            return m_ordered_ops_cache;
+        }
+
     private:
         Function(const Function&) = delete;
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
 
         static std::atomic<size_t> m_next_instance_id;
+        std::shared_ptr<OrderedOpsCache> m_ordered_ops_cache{std::make_shared<OrderedOpsCache>()};
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
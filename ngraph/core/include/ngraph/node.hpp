@@ -22,6 +22,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -59,6 +60,7 @@ namespace ngraph
     class Node;
 
     class Function;
+    class OrderedOpsCache;
 
     namespace runtime
     {
@@ -141,6 +143,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to m_ordered_ops_caches.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -233,7 +238,18 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        /// \brief Validates the node and infers its output types and shapes. Clears the
+        ///        "needs revalidation" state of the node.
+        void revalidate_and_infer_types();
+
+        /// \brief Returns true if the node has to be revalidated, as its inputs were replaced or
+        ///        the types, shapes or values of its inputs could have changed since the last
+        ///        validation.
+        bool needs_revalidation() const { return m_needs_revalidation; }
+        /// \brief Marks the node to be revalidated by the incremental validation, e.g. after its
+        ///        attributes were changed in place.
+        void set_needs_revalidation() { m_needs_revalidation = true; }
+
         /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
         ///        The class name, must not contain spaces as it is used for codegen.
         /// \returns A const reference to the node's type name
@@ -468,6 +484,13 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Marks the consumers of the i-th output to be revalidated.
+        void invalidate_consumers(size_t i);
+
+        /// \brief Drops the cached topological order of the functions this node was sorted in.
+        ///        Called whenever the inputs or control dependencies of the node change.
+        void invalidate_ordered_ops_caches();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -475,8 +498,16 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        // Guards m_ordered_ops_caches of all the nodes, as a node may be sorted by several
+        // functions at once.
+        static std::mutex m_ordered_ops_caches_mutex;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
+        // Declared before m_inputs, as the inputs still mark the node and notify the caches while
+        // being destroyed. The caches are owned by the functions, the expired ones are dropped on
+        // invalidation.
+        bool m_needs_revalidation{true};
+        std::vector<std::weak_ptr<OrderedOpsCache>> m_ordered_ops_caches;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
@@ -50,7 +50,11 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& inputs) const override;
 
                 element::Type get_output_type() const { return m_output_type; }
-                void set_output_type(element::Type output_type) { m_output_type = output_type; }
+                void set_output_type(element::Type output_type)
+                {
+                    m_output_type = output_type;
+                    set_needs_revalidation();
+                }
                 // Overload collision with method on Node
                 using Node::set_output_type;
 
@@ -47,11 +47,13 @@ namespace ngraph
                 void set_destination_type(const element::Type& destination_type)
                 {
                     m_destination_type = destination_type;
+                    set_needs_revalidation();
                 }
                 const element::Type& get_convert_element_type() const { return m_destination_type; }
                 void set_convert_element_type(const element::Type& destination_type)
                 {
                     m_destination_type = destination_type;
+                    set_needs_revalidation();
                 }
 
                 bool evaluate(const HostTensorVector& outputs,
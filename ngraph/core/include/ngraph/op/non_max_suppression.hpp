@@ -170,6 +170,7 @@ namespace ngraph
                 void set_output_type(const element::Type& output_type)
                 {
                     m_output_type = output_type;
+                    set_needs_revalidation();
                 }
                 using Node::set_output_type;
 
@@ -371,6 +372,7 @@ namespace ngraph
                 void set_output_type(const element::Type& output_type)
                 {
                     m_output_type = output_type;
+                    set_needs_revalidation();
                 }
                 using Node::set_output_type;
 
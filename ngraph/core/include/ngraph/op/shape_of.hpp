@@ -41,7 +41,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 element::Type get_output_type() const { return m_output_type; }
-                void set_output_type(element::Type output_type) { m_output_type = output_type; }
+                void set_output_type(element::Type output_type)
+                {
+                    m_output_type = output_type;
+                    set_needs_revalidation();
+                }
                 // Overload collision with method on Node
                 using Node::set_output_type;
 
@@ -88,6 +88,7 @@ namespace ngraph
                 void set_index_element_type(const element::Type& index_element_type)
                 {
                     m_index_element_type = index_element_type;
+                    set_needs_revalidation();
                 }
                 /// \brief Returns the value of K, if available
                 ///
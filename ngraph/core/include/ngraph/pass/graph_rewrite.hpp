@@ -105,10 +105,11 @@ private:
 ///
 /// Graph rewrite pass is used for matcher passes execution on Function.
 /// To register MatcherPass use \sa add_matcher<T>(args) method where T is a MatcherPass class.
-/// As a default algorithm graph rewrite pass traverse Function in topological order and applies
-/// registered matcher passes for each node. But if all registered matcher passes have type based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
-/// Matcher pattern root is type based if it's operation from opset or pattern::op::WrapType.
+/// Graph rewrite pass traverses Function in topological order and applies registered matcher
+/// passes to each node. Matcher passes are indexed by the type and the number of inputs their
+/// pattern root accepts, so for each node only passes that can match it are executed.
+/// Matcher pattern root is type based if it's operation from opset or pattern::op::WrapType
+/// (also wrapped into pattern::op::Label or pattern::op::Or). Other roots are tried on every node.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation from opset
 /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher passes more
 /// efficient.
@@ -28,6 +28,9 @@ namespace ngraph
         ///
         /// \details The verification and inference is done via invoking each node's specific
         /// implementation of \link ngraph::Node::validate_and_infer_types() \endlink function.
+        /// Only the nodes affected by the changes made since the previous validation are
+        /// revalidated, see \link ngraph::Node::needs_revalidation() \endlink. Set the
+        /// NGRAPH_DISABLE_INCREMENTAL_VALIDATION environment variable to revalidate all the nodes.
         ///
         /// By default, the \ref ngraph::pass::Manager runs this pass after executing every
         /// optimization pass. This is to ensure that any update to the graph by an optimization
@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <stdio.h>
 
 #include "ngraph/check.hpp"
@@ -24,16 +26,6 @@ using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        memcpy(out, in, elem_size);
-    }
-
     void reshape_in1(const char* in,
                      char* out,
                      const Shape& in_shape,
@@ -245,7 +237,62 @@ namespace
             }
         }
     }
+
+    // Drops unit axes and merges input axes that stay adjacent and in the same order
+    // in the output, so that e.g. a rank-7 Transpose of a weight or an identity
+    // Reshape collapses to a much smaller problem for the per-rank kernels below.
+    void reduce_dimensions(const Shape& in_shape,
+                           const AxisVector& in_axis_order,
+                           Shape& reduced_shape,
+                           AxisVector& reduced_axis_order)
+    {
+        const size_t rank = in_shape.size();
+        AxisVector order;
+        for (auto axis : in_axis_order)
+        {
+            if (in_shape[axis] != 1)
+            {
+                order.push_back(axis);
+            }
+        }
+
+        // Split the output order into runs of consecutive input axes
+        std::vector<size_t> group_of_axis(rank, 0);
+        std::vector<size_t> group_size;
+        std::vector<size_t> group_first_axis;
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            if (i == 0 || order[i] != order[i - 1] + 1)
+            {
+                group_first_axis.push_back(order[i]);
+                group_size.push_back(1);
+            }
+            group_size.back() *= in_shape[order[i]];
+            group_of_axis[order[i]] = group_size.size() - 1;
+        }
+
+        // Number the runs by the position of their first axis in the input
+        std::vector<size_t> groups_by_input(group_first_axis.size());
+        std::iota(groups_by_input.begin(), groups_by_input.end(), 0);
+        std::sort(groups_by_input.begin(), groups_by_input.end(), [&](size_t a, size_t b) {
+            return group_first_axis[a] < group_first_axis[b];
+        });
+
+        reduced_shape.resize(groups_by_input.size());
+        reduced_axis_order.resize(groups_by_input.size());
+        std::vector<size_t> input_position_of_group(groups_by_input.size());
+        for (size_t i = 0; i < groups_by_input.size(); i++)
+        {
+            reduced_shape[i] = group_size[groups_by_input[i]];
+            input_position_of_group[groups_by_input[i]] = i;
+        }
+        for (size_t i = 0; i < reduced_axis_order.size(); i++)
+        {
+            reduced_axis_order[i] = input_position_of_group[i];
+        }
+    }
 }
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -253,15 +300,54 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    Shape reduced_shape;
+    AxisVector reduced_axis_order;
+    reduce_dimensions(in_shape, in_axis_order, reduced_shape, reduced_axis_order);
+
+    // After merging, the output is a plain copy of the input if at most one axis is left
+    if (reduced_shape.size() <= 1)
+    {
+        memcpy(out, in, shape_size(in_shape) * elem_size);
+        return;
+    }
+
+    // If the innermost input axis stays innermost, its rows are moved as single blocks
+    if (reduced_axis_order.back() == reduced_shape.size() - 1)
+    {
+        elem_size *= reduced_shape.back();
+        reduced_shape.pop_back();
+        reduced_axis_order.pop_back();
+    }
+
+    Shape reduced_out_shape(reduced_shape.size());
+    for (size_t i = 0; i < reduced_shape.size(); i++)
+    {
+        reduced_out_shape[i] = reduced_shape[reduced_axis_order[i]];
+    }
+
+    switch (reduced_shape.size())
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+    case 1:
+        reshape_in1(in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
+    case 2:
+        reshape_in2(in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
+    case 3:
+        reshape_in3(in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
+    case 4:
+        reshape_in4(in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
+    case 5:
+        reshape_in5(in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
+    case 6:
+        reshape_in6(in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
+    default:
+        reference::reshape(
+            in, out, reduced_shape, reduced_axis_order, reduced_out_shape, elem_size);
+        break;
     }
 }
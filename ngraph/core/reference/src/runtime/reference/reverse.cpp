@@ -29,6 +29,12 @@ void runtime::reference::reverse(const char* arg,
                                  const AxisSet& reversed_axes,
                                  size_t elem_size)
 {
+    if (reversed_axes.empty())
+    {
+        memcpy(out, arg, shape_size(arg_shape) * elem_size);
+        return;
+    }
+
     // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with
     // other kernels.
     CoordinateTransform arg_transform(arg_shape);
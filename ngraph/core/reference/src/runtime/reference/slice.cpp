@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <cmath>
+#include <cstring>
 #include <stdio.h>
 
 #include "ngraph/check.hpp"
@@ -35,25 +36,79 @@ namespace ngraph
                        const Shape& out_shape,
                        size_t elem_size)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
+                const size_t rank = arg_shape.size();
+                NGRAPH_CHECK(lower_bounds.size() == rank && upper_bounds.size() == rank &&
+                             strides.size() == rank);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
+                // Number of elements taken along each axis, the input strides in bytes and
+                // the first input element of the slice
+                Shape slice_shape(rank);
+                std::vector<size_t> arg_strides(rank);
+                size_t arg_stride = elem_size;
+                const char* in = arg;
+                for (size_t i = rank; i-- > 0;)
+                {
+                    NGRAPH_CHECK(lower_bounds[i] <= upper_bounds[i] &&
+                                 upper_bounds[i] <= arg_shape[i] && strides[i] > 0);
+                    slice_shape[i] =
+                        (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                    arg_strides[i] = arg_stride * strides[i];
+                    in += lower_bounds[i] * arg_stride;
+                    arg_stride *= arg_shape[i];
+                }
 
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
 
-                for (const Coordinate& in_coord : input_transform)
+                if (rank == 0)
                 {
-                    if (output_it == output_transform.end())
-                        break;
-                    const Coordinate& out_coord = *output_it;
+                    memcpy(out, arg, elem_size);
+                    return;
+                }
+                if (shape_size(slice_shape) == 0)
+                {
+                    return;
+                }
 
-                    memcpy(out + output_transform.index(out_coord) * elem_size,
-                           arg + input_transform.index(in_coord) * elem_size,
-                           elem_size);
+                // The output is written sequentially; the innermost axis is copied as one
+                // block when it is not strided.
+                const size_t inner_count = slice_shape[rank - 1];
+                const size_t inner_stride = arg_strides[rank - 1];
+                const bool inner_is_dense = inner_stride == elem_size;
+                Coordinate counter(rank, 0);
+                while (true)
+                {
+                    if (inner_is_dense)
+                    {
+                        memcpy(out, in, inner_count * elem_size);
+                        out += inner_count * elem_size;
+                    }
+                    else
+                    {
+                        const char* in_elem = in;
+                        for (size_t j = 0; j < inner_count; j++)
+                        {
+                            memcpy(out, in_elem, elem_size);
+                            out += elem_size;
+                            in_elem += inner_stride;
+                        }
+                    }
 
-                    ++output_it;
+                    // Advance the outer axes like an odometer
+                    size_t axis = rank - 1;
+                    while (axis-- > 0)
+                    {
+                        in += arg_strides[axis];
+                        if (++counter[axis] < slice_shape[axis])
+                        {
+                            break;
+                        }
+                        in -= arg_strides[axis] * slice_shape[axis];
+                        counter[axis] = 0;
+                    }
+                    if (axis == static_cast<size_t>(-1))
+                    {
+                        break;
+                    }
                 }
             }
         }
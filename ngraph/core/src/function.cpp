@@ -24,6 +24,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/op_types.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/util.hpp"
 #include "ngraph/validation_util.hpp"
 
@@ -120,10 +121,58 @@ void Function::validate_nodes_and_infer_types()
     }
 }
 
+void Function::validate_changed_nodes_and_infer_types()
+{
+    OV_ITT_SCOPED_TASK(ngraph::itt::domains::nGraphPass_LT,
+                       "Function::validate_changed_nodes_and_infer_types");
+
+    // Revalidated nodes mark their consumers in turn, so walking in the topological order
+    // reaches all the nodes affected by the changes. The bodies of TensorIterator and Loop are
+    // rewritten in place by the passes without marking the ops, so these are always revalidated.
+    for (auto& node : get_ordered_ops())
+    {
+        if (node->needs_revalidation() || std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+        {
+            node->revalidate_and_infer_types();
+        }
+
+        // If we find a parameter make sure it is in the list of parameters of the function
+        if (op::is_parameter(node))
+        {
+            auto it = std::find(m_parameters.begin(), m_parameters.end(), node);
+            if (it == m_parameters.end())
+            {
+                throw ngraph_error("Function references undeclared parameter");
+            }
+        }
+    }
+}
+
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    auto& cache = *m_ordered_ops_cache;
+    std::lock_guard<std::mutex> lock(cache.m_mutex);
+    if (cache.is_valid())
+    {
+        vector<shared_ptr<Node>> nodes;
+        nodes.reserve(cache.m_ordered_ops.size());
+        for (auto& weak_node : cache.m_ordered_ops)
+        {
+            auto node = weak_node.lock();
+            if (!node)
+            {
+                break;
+            }
+            nodes.push_back(std::move(node));
+        }
+        if (nodes.size() == cache.m_ordered_ops.size())
+        {
+            return nodes;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -138,7 +187,32 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+
+    cache.m_ordered_ops.clear();
+    cache.m_ordered_ops.reserve(ordered_ops.size());
+    std::lock_guard<std::mutex> nodes_lock(Node::m_ordered_ops_caches_mutex);
+    for (auto& node : ordered_ops)
+    {
+        // the caches of the destroyed functions are dropped on the way
+        auto& caches = node->m_ordered_ops_caches;
+        bool registered = false;
+        caches.erase(std::remove_if(caches.begin(),
+                                    caches.end(),
+                                    [&](const std::weak_ptr<OrderedOpsCache>& weak_cache) {
+                                        auto cache = weak_cache.lock();
+                                        registered = registered || cache == m_ordered_ops_cache;
+                                        return !cache;
+                                    }),
+                     caches.end());
+        if (!registered)
+        {
+            caches.push_back(m_ordered_ops_cache);
+        }
+        cache.m_ordered_ops.emplace_back(node);
+    }
+    cache.m_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -251,6 +325,7 @@ std::vector<shared_ptr<Node>> Function::get_ops() const
 void Function::replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl)
 {
     ngraph::replace_node(old, repl);
+    m_ordered_ops_cache->invalidate();
 }
 
 size_t Function::get_graph_size() const
@@ -302,11 +377,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    m_ordered_ops_cache->invalidate();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    m_ordered_ops_cache->invalidate();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -376,12 +453,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    m_ordered_ops_cache->invalidate();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    m_ordered_ops_cache->invalidate();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -390,11 +469,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    m_ordered_ops_cache->invalidate();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    m_ordered_ops_cache->invalidate();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -404,6 +485,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    m_ordered_ops_cache->invalidate();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
@@ -19,6 +19,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "itt.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/function.hpp"
@@ -286,57 +287,68 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>>
-    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+namespace
 {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
-    for (auto node : sorted_nodes)
+    // clones the nodes given in topological order
+    void clone_sorted_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& sorted_nodes,
+                            ngraph::NodeMap& node_map)
     {
-        if (node_map.count(node.get()) == 0)
+        node_map.reserve(node_map.size() + sorted_nodes.size());
+        ngraph::OutputVector cloned_args;
+        for (const auto& node : sorted_nodes)
         {
-            // get (already) cloned arguments and clone the node
-            OutputVector cloned_args;
-            for (auto input : node->inputs())
+            if (node_map.count(node.get()) == 0)
             {
-                Output<Node> output = input.get_source_output();
-                cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
-            }
-            std::vector<std::shared_ptr<Node>> cloned_dependencies;
-            for (auto& dependency : node->get_control_dependencies())
-            {
-                shared_ptr<Node>& dependent = node_map.at(dependency.get());
-                if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
-                    cloned_dependencies.end())
+                // get (already) cloned arguments and clone the node
+                cloned_args.clear();
+                cloned_args.reserve(node->get_input_size());
+                for (auto output : node->input_values())
                 {
-                    cloned_dependencies.push_back(dependent);
+                    cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
                 }
-            }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
-            // There is a friendly name for this node so copy it
-            cloned_node->set_friendly_name(node->get_friendly_name());
-            //  TODO: workaround for shape inference, delete it after fix
-            if (std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(cloned_node))
-            {
-                cloned_node->validate_and_infer_types();
-            }
-            auto rt_info = node->get_rt_info();
-            cloned_node->get_rt_info() = rt_info;
+                std::vector<std::shared_ptr<ngraph::Node>> cloned_dependencies;
+                for (const auto& dependency : node->get_control_dependencies())
+                {
+                    std::shared_ptr<ngraph::Node>& dependent = node_map.at(dependency.get());
+                    if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
+                        cloned_dependencies.end())
+                    {
+                        cloned_dependencies.push_back(dependent);
+                    }
+                }
+                auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+                // There is a friendly name for this node so copy it
+                cloned_node->set_friendly_name(node->get_friendly_name());
+                //  TODO: workaround for shape inference, delete it after fix
+                if (std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(cloned_node))
+                {
+                    cloned_node->validate_and_infer_types();
+                }
+                cloned_node->get_rt_info() = node->get_rt_info();
 
-            for (auto tag : node->get_provenance_tags())
-            {
-                cloned_node->add_provenance_tag(tag);
-            }
-            cloned_node->set_op_annotations(node->get_op_annotations());
+                for (const auto& tag : node->get_provenance_tags())
+                {
+                    cloned_node->add_provenance_tag(tag);
+                }
+                cloned_node->set_op_annotations(node->get_op_annotations());
 
-            node_map[node.get()] = cloned_node;
+                node_map[node.get()] = std::move(cloned_node);
+            }
         }
     }
+}
+
+std::vector<std::shared_ptr<ngraph::Node>>
+    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+{
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes), node_map);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
     std::vector<std::shared_ptr<ngraph::Node>> cloned_nodes;
-    for (auto node : nodes)
+    cloned_nodes.reserve(nodes.size());
+    for (const auto& node : nodes)
     {
         cloned_nodes.push_back(node_map.at(node.get()));
     }
@@ -420,8 +432,10 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
-    // clone function operations
-    clone_nodes(func.get_ops(), node_map);
+    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "clone_function");
+
+    // clone function operations, the ordered ops are already sorted and usually cached
+    clone_sorted_nodes(func.get_ordered_ops(), node_map);
 
     // get cloned function results and sinks and parameters
     ResultVector cloned_results;
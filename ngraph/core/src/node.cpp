@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <typeindex>
@@ -32,6 +33,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+mutex Node::m_ordered_ops_caches_mutex;
 
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
@@ -197,6 +199,8 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    m_needs_revalidation = true;
+    invalidate_ordered_ops_caches();
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -230,6 +234,30 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
     validate_and_infer_types();
+    m_needs_revalidation = false;
+}
+
+void Node::revalidate_and_infer_types()
+{
+    validate_and_infer_types();
+    m_needs_revalidation = false;
+    // Shape inference of the consumers may depend on the values of the integral outputs (shape
+    // sub-graphs), and these may change while the output types and shapes stay the same
+    for (size_t i = 0; i < m_outputs.size(); ++i)
+    {
+        if (m_outputs[i].get_element_type().is_integral())
+        {
+            invalidate_consumers(i);
+        }
+    }
+}
+
+void Node::invalidate_consumers(size_t i)
+{
+    for (auto input : m_outputs.at(i).get_inputs())
+    {
+        input->get_raw_pointer_node()->m_needs_revalidation = true;
+    }
 }
 
 void Node::set_output_size(size_t n)
@@ -266,7 +294,13 @@ void Node::set_input_is_relevant_to_value(size_t i, bool relevant)
 
 void Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape)
 {
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    auto& tensor = get_output_descriptor(i).get_tensor();
+    if (tensor.get_element_type() != element_type ||
+        !tensor.get_partial_shape().same_scheme(pshape))
+    {
+        invalidate_consumers(i);
+    }
+    tensor.set_tensor_type(element_type, pshape);
 }
 
 std::string Node::description() const
@@ -481,6 +515,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        invalidate_ordered_ops_caches();
     }
 }
 
@@ -513,6 +548,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_ordered_ops_caches();
         }
     }
     {
@@ -535,6 +571,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_ordered_ops_caches();
 }
 
 void Node::clear_control_dependents()
@@ -545,6 +582,24 @@ void Node::clear_control_dependents()
     }
 }
 
+void Node::invalidate_ordered_ops_caches()
+{
+    std::lock_guard<std::mutex> lock(m_ordered_ops_caches_mutex);
+    m_ordered_ops_caches.erase(
+        std::remove_if(m_ordered_ops_caches.begin(),
+                       m_ordered_ops_caches.end(),
+                       [](const std::weak_ptr<OrderedOpsCache>& weak_cache) {
+                           auto cache = weak_cache.lock();
+                           if (!cache)
+                           {
+                               return true;
+                           }
+                           cache->invalidate();
+                           return false;
+                       }),
+        m_ordered_ops_caches.end());
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
@@ -50,6 +50,7 @@ element::Type op::util::IndexReduction::get_index_element_type() const
 void op::util::IndexReduction::set_index_element_type(const element::Type& index_element_type)
 {
     m_index_element_type = index_element_type;
+    set_needs_revalidation();
 }
 
 void op::util::IndexReduction::validate_and_infer_types()
@@ -29,7 +29,10 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
 
     for (auto&& node : f->get_ordered_ops())
     {
-        node->revalidate_and_infer_types();
+        if (node->needs_revalidation())
+        {
+            node->revalidate_and_infer_types();
+        }
 
         // recursively constant fold operators containing subgraphs (ie: TensorIterator)
         if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
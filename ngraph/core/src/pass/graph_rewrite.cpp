@@ -17,7 +17,6 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
-#include <pattern/op/wrap_type.hpp>
 #include <regex>
 #include <unordered_set>
 #include <vector>
@@ -27,6 +26,10 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/pattern/op/any_output.hpp"
+#include "ngraph/pattern/op/label.hpp"
+#include "ngraph/pattern/op/or.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -63,6 +66,125 @@ using namespace ngraph;
 // If MatcherPass register more than one node make sure that this nodes are registered in
 // topological order.
 
+namespace
+{
+    // Conservative description of the nodes a pattern root can match: a node is rejected only
+    // if its type is not castable to any of the root types or its number of inputs differs
+    // from the one the root pattern requires.
+    struct RootSignature
+    {
+        bool any_type = true;
+        std::vector<NodeTypeInfo> types;
+        bool any_arity = true;
+        size_t arity = 0;
+
+        bool accepts(const NodeTypeInfo& type, size_t input_size) const
+        {
+            if (!any_arity && arity != input_size)
+            {
+                return false;
+            }
+            return any_type || std::any_of(types.begin(),
+                                           types.end(),
+                                           [&](const NodeTypeInfo& root_type) {
+                                               return type.is_castable(root_type);
+                                           });
+        }
+    };
+
+    RootSignature get_root_signature(const Output<Node>& pattern_value)
+    {
+        auto root = pattern_value.get_node_shared_ptr();
+        RootSignature signature;
+        // pattern::op::AnyOutput operation automatically appends for multi output operations
+        // inside Matcher and to get actual root node we need to take it's parent.
+        if (dynamic_pointer_cast<pattern::op::AnyOutput>(root))
+        {
+            return get_root_signature(root->input_value(0));
+        }
+        if (auto wrap_type = dynamic_pointer_cast<pattern::op::WrapType>(root))
+        {
+            signature.any_type = false;
+            signature.types.push_back(wrap_type->get_wrapped_type());
+            // WrapType without inputs does not check arguments of the matched node
+            signature.any_arity = root->get_input_size() == 0;
+            signature.arity = root->get_input_size();
+        }
+        else if (dynamic_pointer_cast<pattern::op::Label>(root))
+        {
+            // Label matches the same value as the pattern it wraps
+            return get_root_signature(root->input_value(0));
+        }
+        else if (dynamic_pointer_cast<pattern::op::Or>(root))
+        {
+            // Or matches if any of its alternatives matches
+            signature.any_type = false;
+            signature.any_arity = false;
+            for (size_t i = 0; i < root->get_input_size(); ++i)
+            {
+                const auto alternative = get_root_signature(root->input_value(i));
+                signature.any_type |= alternative.any_type;
+                signature.types.insert(
+                    signature.types.end(), alternative.types.begin(), alternative.types.end());
+                signature.any_arity |= alternative.any_arity ||
+                                       (i > 0 && alternative.arity != signature.arity);
+                signature.arity = alternative.arity;
+            }
+        }
+        else if (!dynamic_pointer_cast<pattern::op::Pattern>(root))
+        {
+            // Operations in patterns match nodes of the same or derived type with the same
+            // number of inputs
+            signature.any_type = false;
+            signature.types.push_back(root->get_type_info());
+            signature.any_arity = false;
+            signature.arity = root->get_input_size();
+        }
+        return signature;
+    }
+
+    // Dispatch index of MatcherPasses by root signature. Candidate lists are computed once per
+    // node type and number of inputs, so nodes that no pattern can match are rejected with a
+    // hash lookup instead of running every matcher.
+    class MatcherPassIndex
+    {
+    public:
+        void add(size_t matcher_index, const std::shared_ptr<pattern::Matcher>& matcher)
+        {
+            // MatcherPass without Matcher can be applied to any node
+            m_signatures.emplace_back(matcher_index,
+                                      matcher ? get_root_signature(matcher->get_pattern_value())
+                                              : RootSignature());
+        }
+
+        const std::vector<size_t>& get_candidates(const Node& node)
+        {
+            const auto& type = node.get_type_info();
+            const size_t input_size = node.get_input_size();
+            auto& candidates_by_arity = m_candidates[type];
+            auto it = candidates_by_arity.find(input_size);
+            if (it == candidates_by_arity.end())
+            {
+                std::vector<size_t> candidates;
+                for (const auto& signature : m_signatures)
+                {
+                    if (signature.second.accepts(type, input_size))
+                    {
+                        candidates.push_back(signature.first);
+                    }
+                }
+                it = candidates_by_arity.emplace(input_size, std::move(candidates)).first;
+            }
+            return it->second;
+        }
+
+    private:
+        std::vector<std::pair<size_t, RootSignature>> m_signatures;
+        std::unordered_map<NodeTypeInfo, std::unordered_map<size_t, std::vector<size_t>>>
+            m_candidates;
+    };
+}
+
 NGRAPH_RTTI_DEFINITION(ngraph::pass::GraphRewrite, "ngraph::pass::GraphRewrite", 0);
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::MatcherPass, "ngraph::pass::MatcherPass", 0);
@@ -81,51 +203,14 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         nodes_to_run.emplace_back(node);
     }
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
-    for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
+    // Compile root signatures of enabled MatcherPasses into the dispatch index
+    MatcherPassIndex matcher_index;
+    for (size_t i = 0; i < m_matchers.size(); ++i)
     {
         // Skip passes that are disabled
-        if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
+        if (pass_config->is_disabled(m_matchers[i]->get_type_info()))
             continue;
-
-        auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher)
-        {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = dynamic_pointer_cast<pattern::op::AnyOutput>(root))
-        {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        NodeTypeInfo root_type_info = root->get_type_info();
-        if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
-        {
-            if (auto any_type = dynamic_pointer_cast<pattern::op::WrapType>(p))
-            {
-                root_type_info = any_type->get_wrapped_type();
-            }
-            else
-            {
-                all_roots_has_type = false;
-                break;
-            }
-        }
-        type_to_matcher[root_type_info].push_back(matcher_index);
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
+        matcher_index.add(i, m_matchers[i]->get_matcher());
     }
 
     // This lambda preforms execution of particular MatcherPass on given node.
@@ -164,9 +249,6 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty())
     {
         auto node = nodes_to_run.front();
@@ -180,59 +262,18 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
         }
         // Temporary keep this GraphRewrite property for backward compatibility
-        if (m_enable_shape_inference)
+        if (m_enable_shape_inference && node->needs_revalidation())
         {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
+        // Only MatcherPasses whose pattern root can accept this node's type and number of
+        // inputs are tried, in order of registration
+        for (size_t i : matcher_index.get_candidates(*node))
         {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
+            if (run_matcher_pass(m_matchers[i], node))
             {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
-                {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run)
-            {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
-                {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
-        {
-            for (auto& m_pass : m_matchers)
-            {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                rewritten = true;
+                break;
             }
         }
     }
@@ -16,6 +16,7 @@
 
 #include "ngraph/pass/validate.hpp"
 #include "itt.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 
 using namespace ngraph;
@@ -24,6 +25,15 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::Validate, "ngraph::pass::Validate", 0);
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    static const bool incremental_validation =
+        !getenv_bool("NGRAPH_DISABLE_INCREMENTAL_VALIDATION");
+    if (incremental_validation)
+    {
+        f->validate_changed_nodes_and_infer_types();
+    }
+    else
+    {
+        f->validate_nodes_and_infer_types();
+    }
     return false;
 }
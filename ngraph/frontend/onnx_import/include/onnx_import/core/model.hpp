@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -42,6 +43,12 @@ namespace ngraph
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
 
+            /// \brief      Creates a model which shares the ownership of the protobuf message.
+            ///
+            /// \note       Initializers of such a model are imported without copying their
+            ///             raw data, the resulting Constants keep the message alive.
+            explicit Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -52,6 +59,11 @@ namespace ngraph
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
             const OpsetImports& get_opset_imports() const;
+            /// \return The owner of the protobuf message or nullptr if the model does not own it.
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_model_proto_owner() const
+            {
+                return m_model_proto_owner;
+            }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -84,6 +96,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto_owner;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
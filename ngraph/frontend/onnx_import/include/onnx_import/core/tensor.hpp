@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "tensor_external_data.hpp"
@@ -159,12 +162,21 @@ namespace ngraph
                         }
 
                         template <typename T>
-                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                        inline std::vector<T> __get_raw_data(const char* raw_data,
+                                                             std::size_t raw_data_size,
                                                              int onnx_data_type)
                         {
-                            auto it = reinterpret_cast<const T*>(raw_data.data());
+                            auto it = reinterpret_cast<const T*>(raw_data);
                             return std::vector<T>(
-                                it, it + (raw_data.size() / __get_onnx_data_size(onnx_data_type)));
+                                it, it + (raw_data_size / __get_onnx_data_size(onnx_data_type)));
+                        }
+
+                        template <typename T>
+                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                                                             int onnx_data_type)
+                        {
+                            return __get_raw_data<T>(
+                                raw_data.data(), raw_data.size(), onnx_data_type);
                         }
 
                         template <typename T>
@@ -172,9 +184,10 @@ namespace ngraph
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
                         {
                             const auto tensor_external_data = TensorExternalData(tensor);
-                            const auto raw_data = tensor_external_data.load_external_data();
+                            const auto mapped_data = tensor_external_data.map_external_data();
 
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            return detail::__get_raw_data<T>(
+                                mapped_data->data(), mapped_data->size(), tensor.data_type());
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -483,8 +496,18 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+
+            /// \brief      Wraps a tensor protobuf message.
+            ///
+            /// \param[in]  tensor       The tensor protobuf message.
+            /// \param[in]  model_proto  The model message which owns \p tensor, if any. When it is
+            ///                          provided, Constants created from raw_data alias the
+            ///                          protobuf storage and keep the model alive instead of
+            ///                          copying the data.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -603,11 +626,66 @@ namespace ngraph
             }
 
         private:
+            /// \brief      Checks whether a buffer can back a Constant of type T without a copy.
+            template <typename T>
+            bool can_alias_data(const char* data,
+                                std::size_t size,
+                                const element::Type& type) const
+            {
+                return sizeof(T) == type.size() && size == shape_size(m_shape) * type.size() &&
+                       size != 0 && reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0;
+            }
+
+            /// \brief      Creates a Constant aliasing the tensor data when it is stored in
+            ///             raw_data of an owned model or in an external file, so the weights
+            ///             are not copied.
+            ///
+            /// \return     The Constant or nullptr if the data has to be converted or copied.
+            template <typename T>
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    auto mapped_data =
+                        detail::TensorExternalData(*m_tensor_proto).map_external_data();
+                    if (!can_alias_data<T>(mapped_data->data(), mapped_data->size(), type))
+                    {
+                        return nullptr;
+                    }
+                    auto buffer = std::make_shared<
+                        runtime::SharedBuffer<std::shared_ptr<detail::MappedExternalData>>>(
+                        mapped_data->data(), mapped_data->size(), mapped_data);
+                    return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+                if (m_model_proto && m_tensor_proto->has_raw_data())
+                {
+                    const auto& raw_data = m_tensor_proto->raw_data();
+                    if (!can_alias_data<T>(raw_data.data(), raw_data.size(), type))
+                    {
+                        return nullptr;
+                    }
+                    auto model_proto = m_model_proto;
+                    auto buffer = std::make_shared<
+                        runtime::SharedBuffer<std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>>(
+                        const_cast<char*>(raw_data.data()), raw_data.size(), model_proto);
+                    return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+                return nullptr;
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant<T>(type);
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -616,6 +694,7 @@ namespace ngraph
             }
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
+#include <string>
 
 namespace ngraph
 {
@@ -24,6 +26,33 @@ namespace ngraph
     {
         namespace detail
         {
+            /// \brief  Read-only view of a region of an external data file.
+            ///
+            /// \note   On POSIX systems the region is mapped into memory with mmap, so its pages
+            ///         are loaded lazily and shared with the page cache. Elsewhere, or when the
+            ///         mapping fails, the region is read into a buffer owned by this object.
+            class MappedExternalData
+            {
+            public:
+                MappedExternalData() = default;
+                ~MappedExternalData();
+
+                MappedExternalData(const MappedExternalData&) = delete;
+                MappedExternalData& operator=(const MappedExternalData&) = delete;
+
+                char* data() const { return m_data; }
+                std::size_t size() const { return m_size; }
+
+            private:
+                friend class TensorExternalData;
+
+                char* m_data = nullptr;
+                std::size_t m_size = 0;
+                void* m_mapping = nullptr;
+                std::size_t m_mapping_size = 0;
+                std::string m_buffer;
+            };
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -39,6 +68,15 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor
+                ///
+                /// \note       If the external file cannot be opened or the requested region
+                ///             exceeds it, the invalid_external_data exception is thrown.
+                ///
+                /// \return     Shared view of the external data, which stays valid for as long
+                ///             as any copy of the returned pointer is alive
+                std::shared_ptr<MappedExternalData> map_external_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
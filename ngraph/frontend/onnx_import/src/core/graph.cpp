@@ -14,11 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <numeric>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
+#include "itt.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/provenance.hpp"
@@ -61,6 +67,144 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            /// \brief      Caches ITT annotation handles of the ONNX operator types.
+            class PerfCounters
+            {
+                PerfCounters(PerfCounters const&) = delete;
+                PerfCounters& operator=(PerfCounters const&) = delete;
+
+            public:
+                PerfCounters() = default;
+
+                openvino::itt::handle_t operator[](const std::string& op_type)
+                {
+                    std::lock_guard<std::mutex> guard(m_mutex);
+                    auto it = m_counters.find(op_type);
+                    if (it != m_counters.end())
+                        return it->second;
+                    return m_counters[op_type] = openvino::itt::handle("ONNX::" + op_type);
+                }
+
+            private:
+                std::mutex m_mutex;
+                std::unordered_map<std::string, openvino::itt::handle_t> m_counters;
+            };
+
+            static PerfCounters& perf_counters()
+            {
+                static PerfCounters counters;
+                return counters;
+            }
+
+            /// \brief      Creates an nGraph Constant for the initializer tensor.
+            ///
+            /// \note       Errors which leave the model unusable are captured in \p exception
+            ///             instead of being thrown, so they can be raised from the calling
+            ///             thread in the order of the initializers.
+            static std::shared_ptr<default_opset::Constant>
+                make_initializer_constant(const Tensor& tensor, std::exception_ptr& exception)
+            {
+                try
+                {
+                    return tensor.get_ng_constant();
+                }
+                catch (const error::invalid_external_data&)
+                {
+                    // invalid external data makes initializers creation impossible
+                    exception = std::current_exception();
+                }
+                catch (const ngraph::ngraph_error& exc)
+                {
+                    NGRAPH_WARN << "Could not create an nGraph Constant for initializer '"
+                                << tensor.get_name() << "'. Detailed error:\n"
+                                << exc.what();
+                    try
+                    {
+                        return default_opset::Constant::create(
+                            tensor.get_ng_type(), Shape{}, {0});
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+                catch (...)
+                {
+                    exception = std::current_exception();
+                }
+                return nullptr;
+            }
+
+            /// \brief      Creates nGraph Constants for the initializer tensors.
+            ///
+            /// \note       Initializers are independent of each other, so when there is enough
+            ///             data to decode they are split into contiguous chunks converted on
+            ///             separate threads.
+            static std::vector<std::shared_ptr<default_opset::Constant>>
+                make_initializer_constants(const std::vector<Tensor>& tensors)
+            {
+                // Below this number of elements thread startup costs more than the decoding
+                static const std::size_t min_parallel_elements = 1 << 20;
+
+                std::vector<std::shared_ptr<default_opset::Constant>> constants(tensors.size());
+                std::vector<std::exception_ptr> exceptions(tensors.size());
+
+                std::size_t total_elements = 0;
+                for (const auto& tensor : tensors)
+                {
+                    total_elements += shape_size(tensor.get_shape());
+                }
+                const std::size_t threads =
+                    total_elements < min_parallel_elements
+                        ? 1
+                        : std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                                tensors.size());
+
+                auto convert_range = [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        constants[i] = make_initializer_constant(tensors[i], exceptions[i]);
+                    }
+                };
+
+                if (threads <= 1)
+                {
+                    convert_range(0, tensors.size());
+                }
+                else
+                {
+                    // Chunks are balanced by the number of elements, not the number of tensors
+                    const std::size_t chunk_elements = (total_elements + threads - 1) / threads;
+                    std::vector<std::future<void>> futures;
+                    std::size_t begin = 0;
+                    std::size_t chunk_size = 0;
+                    for (std::size_t i = 0; i < tensors.size(); ++i)
+                    {
+                        chunk_size += shape_size(tensors[i].get_shape());
+                        if (chunk_size >= chunk_elements || i + 1 == tensors.size())
+                        {
+                            futures.push_back(
+                                std::async(std::launch::async, convert_range, begin, i + 1));
+                            begin = i + 1;
+                            chunk_size = 0;
+                        }
+                    }
+                    for (auto& future : futures)
+                    {
+                        future.get();
+                    }
+                }
+
+                for (const auto& exception : exceptions)
+                {
+                    if (exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+                return constants;
+            }
         } // namespace detail
 
         Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
@@ -75,39 +219,32 @@ namespace ngraph
             , m_model{&model}
             , m_cache{std::move(cache)}
         {
-            std::map<std::string, Tensor> initializers;
-            // Process all initializers in the graph
+            OV_ITT_TASK_CHAIN(taskChain, itt::domains::ONNXImport, "Graph", "initializers");
+
+            std::vector<Tensor> initializer_tensors;
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    std::shared_ptr<default_opset::Constant> ng_constant;
-                    // For each initializer create a Constant node and store it in cache
-                    try
-                    {
-                        ng_constant = tensor.get_ng_constant();
-                    }
-                    catch (const error::invalid_external_data&)
-                    {
-                        // invalid external data makes initializers creation impossible
-                        throw;
-                    }
-                    catch (const ngraph::ngraph_error& exc)
-                    {
-                        NGRAPH_WARN << "Could not create an nGraph Constant for initializer '"
-                                    << initializer_tensor.name() << "'. Detailed error:\n"
-                                    << exc.what();
-                        ng_constant =
-                            default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
-                    }
-
-                    initializers.emplace(initializer_tensor.name(), tensor);
-                    add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+                    initializer_tensors.emplace_back(initializer_tensor,
+                                                     m_model->get_model_proto_owner());
                 }
             }
 
+            // Process all initializers in the graph
+            std::map<std::string, Tensor> initializers;
+            auto ng_constants = detail::make_initializer_constants(initializer_tensors);
+            for (std::size_t i = 0; i < initializer_tensors.size(); ++i)
+            {
+                const auto& tensor = initializer_tensors[i];
+                auto& ng_constant = ng_constants[i];
+                initializers.emplace(tensor.get_name(), tensor);
+                add_provenance_tag_to_initializer(tensor, ng_constant);
+                m_cache->emplace_node(tensor.get_name(), std::move(ng_constant));
+            }
+
+            OV_ITT_TASK_NEXT(taskChain, "inputs");
+
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_graph_proto->input())
             {
@@ -131,6 +268,8 @@ namespace ngraph
                 m_outputs.emplace_back(output);
             }
 
+            OV_ITT_TASK_NEXT(taskChain, "check_operators");
+
             // Verify that ONNX graph contains only nodes of available operator types
             std::map<std::string, std::reference_wrapper<const ONNX_NAMESPACE::NodeProto>>
                 unknown_operators;
@@ -164,7 +303,10 @@ namespace ngraph
                          "nGraph does not support the following ONNX operations: ",
                          detail::to_string(unknown_operators));
 
+            OV_ITT_TASK_NEXT(taskChain, "nodes");
+
             // Process ONNX graph nodes, convert to nGraph nodes
+            m_nodes.reserve(m_graph_proto->node_size());
             for (const auto& node_proto : m_graph_proto->node())
             {
                 m_nodes.emplace_back(node_proto, *this);
@@ -204,7 +346,10 @@ namespace ngraph
 
         OutputVector Graph::make_ng_nodes(const Node& onnx_node) const
         {
-            const auto ng_node_factory =
+            OV_ITT_SCOPED_TASK(itt::domains::ONNXImportOp,
+                               detail::perf_counters()[onnx_node.op_type()]);
+
+            const auto& ng_node_factory =
                 m_model->get_operator(onnx_node.op_type(), onnx_node.domain());
             OutputVector ng_node_vector;
             try
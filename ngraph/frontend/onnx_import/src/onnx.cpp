@@ -19,6 +19,7 @@
 #include <google/protobuf/text_format.h>
 #include <memory>
 
+#include "itt.hpp"
 #include "ngraph/except.hpp"
 #include "onnx_import/core/graph.hpp"
 #include "onnx_import/core/model.hpp"
@@ -74,11 +75,13 @@ namespace ngraph
 
             } // namespace error
 
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            std::shared_ptr<Function> convert_to_ng_function(
+                std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
             {
+                OV_ITT_SCOPED_TASK(itt::domains::ONNXImport, "convert_to_ng_function");
+
                 Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                Graph graph{model_proto->graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -103,7 +106,11 @@ namespace ngraph
                 }
             }
 
-            ONNX_NAMESPACE::ModelProto model_proto;
+            OV_ITT_TASK_CHAIN(taskChain, itt::domains::ONNXImport, "import_onnx_model", "parse");
+
+            // The model is shared with the imported Constants, which alias its initializers.
+            auto model_proto_ptr = std::make_shared<ONNX_NAMESPACE::ModelProto>();
+            auto& model_proto = *model_proto_ptr;
             // Try parsing input as a binary protobuf message
             if (!model_proto.ParseFromIstream(&stream))
             {
@@ -122,11 +129,15 @@ namespace ngraph
 #endif
             }
 
+            OV_ITT_TASK_NEXT(taskChain, "transform");
+
             transform::expand_onnx_functions(model_proto);
             transform::fixup_legacy_operators(model_proto);
             transform::update_external_data_paths(model_proto, model_path);
 
-            return detail::convert_to_ng_function(model_proto);
+            OV_ITT_TASK_NEXT(taskChain, "convert");
+
+            return detail::convert_to_ng_function(std::move(model_proto_ptr));
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -14,9 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "onnx_import/exceptions.hpp"
@@ -43,8 +51,88 @@ namespace ngraph
                 }
             }
 
+            MappedExternalData::~MappedExternalData()
+            {
+#ifndef _WIN32
+                if (m_mapping != nullptr)
+                {
+                    munmap(m_mapping, m_mapping_size);
+                }
+#endif
+            }
+
             std::string TensorExternalData::load_external_data() const
             {
+                const auto mapped_data = map_external_data();
+                return std::string(mapped_data->data(), mapped_data->size());
+            }
+
+            std::shared_ptr<MappedExternalData> TensorExternalData::map_external_data() const
+            {
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+                if (m_offset < 0 || m_data_lenght < 0)
+                {
+                    throw error::invalid_external_data{*this};
+                }
+
+                auto mapped_data = std::make_shared<MappedExternalData>();
+#ifndef _WIN32
+                const int fd = open(m_data_location.c_str(), O_RDONLY);
+                if (fd < 0)
+                {
+                    throw error::invalid_external_data{*this};
+                }
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) != 0)
+                {
+                    close(fd);
+                    throw error::invalid_external_data{*this};
+                }
+                const auto file_size = static_cast<std::size_t>(file_stat.st_size);
+                const auto offset = static_cast<std::size_t>(m_offset);
+                // default value of m_data_lenght is 0, which means "up to the end of file"
+                const auto length = m_data_lenght == 0 ? file_size - std::min(offset, file_size)
+                                                       : static_cast<std::size_t>(m_data_lenght);
+                if (offset + length > file_size)
+                {
+                    close(fd);
+                    throw error::invalid_external_data{*this};
+                }
+                if (length == 0)
+                {
+                    close(fd);
+                    return mapped_data;
+                }
+
+                // mmap requires a page aligned file offset, so the mapping starts at the page
+                // containing the first byte and the returned view skips the leading bytes.
+                const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                const auto mapping_offset = offset - offset % page_size;
+                const auto mapping_size = length + (offset - mapping_offset);
+                // A private writable mapping keeps the file untouched even if a consumer
+                // modifies the data; pages are copied only when they are actually written.
+                void* mapping = mmap(nullptr,
+                                     mapping_size,
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_PRIVATE,
+                                     fd,
+                                     static_cast<off_t>(mapping_offset));
+                close(fd);
+                if (mapping != MAP_FAILED)
+                {
+                    mapped_data->m_mapping = mapping;
+                    mapped_data->m_mapping_size = mapping_size;
+                    mapped_data->m_data = static_cast<char*>(mapping) + (offset - mapping_offset);
+                    mapped_data->m_size = length;
+                    return mapped_data;
+                }
+                NGRAPH_WARN << "Could not map external data, falling back to reading the file: "
+                            << to_string();
+#endif
+
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
 #else
@@ -55,33 +143,27 @@ namespace ngraph
                 if (external_data_stream.fail())
                     throw error::invalid_external_data{*this};
 
-                std::streamsize read_data_lenght;
-                if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
+                const auto stream_size = static_cast<std::size_t>(external_data_stream.tellg());
+                const auto stream_offset = static_cast<std::size_t>(m_offset);
+                std::size_t read_data_lenght;
+                if (m_data_lenght == 0) // read up to the end of file
+                    read_data_lenght = stream_size - std::min(stream_offset, stream_size);
                 else
-                    read_data_lenght = m_data_lenght;
+                    read_data_lenght = static_cast<std::size_t>(m_data_lenght);
+                if (stream_offset + read_data_lenght > stream_size)
+                    throw error::invalid_external_data{*this};
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
                 external_data_stream.seekg(m_offset, std::ios::beg);
 
-                if (m_sha1_digest != 0)
-                {
-                    NGRAPH_WARN << "SHA1 checksum is not supported";
-                }
-
-                std::string read_data;
+                auto& read_data = mapped_data->m_buffer;
                 read_data.resize(read_data_lenght);
                 external_data_stream.read(&read_data[0], read_data_lenght);
                 external_data_stream.close();
 
-                return read_data;
+                mapped_data->m_data = &read_data[0];
+                mapped_data->m_size = read_data.size();
+                return mapped_data;
             }
 
             std::string TensorExternalData::to_string() const
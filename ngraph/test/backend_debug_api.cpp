@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
@@ -76,3 +77,88 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, intermediate_memory_reuse)
+{
+    Shape shape{1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    Output<Node> last = A;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        last = make_shared<op::Relu>(make_shared<op::Negative>(last));
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), -1.f));
+    auto result = backend->create_tensor(element::f32, shape);
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    auto ihandle = static_pointer_cast<runtime::interpreter::INTExecutable>(handle);
+    // only an op's input and output are alive at the same time
+    EXPECT_EQ(ihandle->get_intermediate_memory_size(), 2 * shape_size(shape) * sizeof(float));
+
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 0.f));
+}
+
+TEST(INTERPRETER, parallel_branches)
+{
+    // branches are large enough to be executed concurrently
+    Shape shape{1 << 14};
+    const size_t num_branches = 8;
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    OutputVector branches;
+    for (size_t i = 0; i < num_branches; ++i)
+    {
+        auto c = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), i));
+        branches.push_back(make_shared<op::Multiply>(A, c));
+    }
+    Output<Node> sum = branches[0];
+    for (size_t i = 1; i < num_branches; ++i)
+    {
+        sum = make_shared<op::Add>(sum, branches[i]);
+    }
+    auto f = make_shared<Function>(OutputVector{sum}, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    vector<float> a_data(shape_size(shape));
+    iota(a_data.begin(), a_data.end(), 0.f);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    for (size_t call = 0; call < 3; ++call)
+    {
+        handle->call_with_validate({result}, {a});
+        vector<float> expected(a_data);
+        for (auto& value : expected)
+        {
+            value *= num_branches * (num_branches - 1) / 2;
+        }
+        EXPECT_EQ(read_vector<float>(result), expected);
+    }
+}
+
+TEST(INTERPRETER, nan_check_parallel_branches)
+{
+    Shape shape{1 << 14};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Add>(make_shared<op::Divide>(A, B), make_shared<op::Multiply>(A, B)),
+        ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 0.f));
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>(shape_size(shape), 0.f));
+    auto result = backend->create_tensor(element::f32, shape);
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    static_pointer_cast<runtime::interpreter::INTExecutable>(handle)->set_nan_check(true);
+    EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
+}
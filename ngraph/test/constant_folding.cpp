@@ -19,6 +19,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -1674,6 +1675,30 @@ TEST(constant_folding, const_gather_v1)
     ASSERT_TRUE(test::all_close_f(values_out, values_expected, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, const_gather_v1_negative_indices)
+{
+    Shape shape_in{2, 3, 4};
+    vector<int32_t> values_in(shape_size(shape_in));
+    iota(values_in.begin(), values_in.end(), 0);
+    auto constant_data = make_shared<op::Constant>(element::i32, shape_in, values_in);
+    auto constant_indices =
+        op::Constant::create(element::i32, Shape{2, 2}, vector<int32_t>{-1, 0, 2, -3});
+    auto constant_axis = op::Constant::create(element::i64, Shape{1}, vector<int64_t>{1});
+    auto gather = make_shared<op::v1::Gather>(constant_data, constant_indices, constant_axis);
+    auto f = make_shared<Function>(gather, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Gather>(f), 0);
+    ASSERT_EQ(gather->get_output_shape(0), (Shape{2, 2, 2, 4}));
+
+    vector<int32_t> values_expected{8,  9,  10, 11, 0,  1,  2,  3,  8,  9,  10, 11, 0,  1,  2,  3,
+                                    20, 21, 22, 23, 12, 13, 14, 15, 20, 21, 22, 23, 12, 13, 14, 15};
+    ASSERT_EQ(get_result_constant<int32_t>(f, 0), values_expected);
+}
+
 TEST(constant_folding, const_gather_v1_scalar)
 {
     auto constant_data = op::Constant::create(
@@ -1945,6 +1970,47 @@ TEST(constant_folding, const_strided_slice)
     ASSERT_EQ(sliced_values, values_out);
 }
 
+TEST(constant_folding, const_strided_slice_3d)
+{
+    Shape shape_in{4, 5, 6};
+    vector<int> values_in(shape_size(shape_in));
+    iota(values_in.begin(), values_in.end(), 0);
+
+    // strided and dense innermost axis
+    vector<vector<int64_t>> begins{{1, 0, 1}, {1, 1, 0}};
+    vector<vector<int64_t>> ends{{4, 5, 6}, {3, 4, 6}};
+    vector<vector<int64_t>> strides{{2, 1, 2}, {1, 2, 1}};
+
+    for (size_t i = 0; i < begins.size(); ++i)
+    {
+        auto constant = make_shared<op::Constant>(element::i32, shape_in, values_in);
+        auto begin = op::Constant::create(element::i64, {3}, begins[i]);
+        auto end = op::Constant::create(element::i64, {3}, ends[i]);
+        auto stride = op::Constant::create(element::i64, {3}, strides[i]);
+        auto slice = make_shared<op::v1::StridedSlice>(
+            constant, begin, end, stride, vector<int64_t>(3, 0), vector<int64_t>(3, 0));
+        auto f = make_shared<Function>(slice, ParameterVector{});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+        ASSERT_EQ(count_ops_of_type<op::v1::StridedSlice>(f), 0);
+
+        vector<int> values_expected;
+        for (int64_t d0 = begins[i][0]; d0 < ends[i][0]; d0 += strides[i][0])
+        {
+            for (int64_t d1 = begins[i][1]; d1 < ends[i][1]; d1 += strides[i][1])
+            {
+                for (int64_t d2 = begins[i][2]; d2 < ends[i][2]; d2 += strides[i][2])
+                {
+                    values_expected.push_back(values_in[(d0 * 5 + d1) * 6 + d2]);
+                }
+            }
+        }
+        ASSERT_EQ(get_result_constant<int>(f, 0), values_expected);
+    }
+}
+
 TEST(constant_folding, constant_dyn_reshape)
 {
     Shape shape_in{2, 4};
@@ -2045,6 +2111,38 @@ TEST(constant_folding, constant_transpose)
     ASSERT_TRUE(test::all_close_f(values_permute, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, constant_transpose_all_permutations)
+{
+    Shape shape_in{2, 3, 1, 4, 5};
+    vector<int32_t> values_in(shape_size(shape_in));
+    iota(values_in.begin(), values_in.end(), 0);
+
+    vector<int64_t> values_perm{0, 1, 2, 3, 4};
+    do
+    {
+        auto constant_in = make_shared<op::Constant>(element::i32, shape_in, values_in);
+        auto constant_perm = op::Constant::create(element::i64, Shape{5}, values_perm);
+        auto transpose = make_shared<op::Transpose>(constant_in, constant_perm);
+        auto f = make_shared<Function>(transpose, ParameterVector{});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+        ASSERT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+
+        const AxisVector axis_order(values_perm.begin(), values_perm.end());
+        const Shape shape_out = transpose->get_output_shape(0);
+        vector<int32_t> values_expected(values_in.size());
+        runtime::reference::reshape(reinterpret_cast<const char*>(values_in.data()),
+                                    reinterpret_cast<char*>(values_expected.data()),
+                                    shape_in,
+                                    axis_order,
+                                    shape_out,
+                                    sizeof(int32_t));
+        ASSERT_EQ(get_result_constant<int32_t>(f, 0), values_expected);
+    } while (next_permutation(values_perm.begin(), values_perm.end()));
+}
+
 template <typename T>
 void range_test(T start, T stop, T step, const vector<T>& values_expected)
 {
@@ -3108,3 +3206,42 @@ TEST(constant_folding, disable_constant_folding)
     ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(f), 1);
     ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
 }
+
+TEST(benchmark, constant_folding_large_weights)
+{
+    // weight preprocessing subgraph of the kind produced by frontends for a large layer
+    Shape shape_in{512, 512, 3, 3};
+    vector<float> values_in(shape_size(shape_in));
+    iota(values_in.begin(), values_in.end(), 0.f);
+
+    auto make_function = [&]() {
+        auto weights = make_shared<op::Constant>(element::f32, shape_in, values_in);
+        auto transpose = make_shared<op::Transpose>(
+            weights, op::Constant::create(element::i64, Shape{4}, {2, 3, 1, 0}));
+        auto reshape = make_shared<op::v1::Reshape>(
+            transpose, op::Constant::create(element::i64, Shape{3}, {9, 512, 512}), false);
+        auto slice = make_shared<op::v1::StridedSlice>(
+            reshape,
+            op::Constant::create(element::i64, Shape{3}, {0, 0, 0}),
+            op::Constant::create(element::i64, Shape{3}, {9, 512, 512}),
+            op::Constant::create(element::i64, Shape{3}, {1, 2, 1}),
+            vector<int64_t>(3, 0),
+            vector<int64_t>(3, 0));
+        auto gather = make_shared<op::v1::Gather>(
+            slice,
+            op::Constant::create(element::i64, Shape{4}, {8, 0, -1, 4}),
+            op::Constant::create(element::i64, Shape{}, {0}));
+        return make_shared<Function>(gather, ParameterVector{});
+    };
+
+    auto f = make_function();
+    stopwatch timer;
+    timer.start();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+    timer.stop();
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    NGRAPH_INFO << "folding " << shape_size(shape_in) << " weights " << timer.get_milliseconds()
+                << "ms";
+}
@@ -0,0 +1,476 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset5.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/validate.hpp"
+#include "ngraph/util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    NodeVector sorted_from_scratch(const shared_ptr<Function>& f)
+    {
+        NodeVector roots;
+        roots.insert(roots.end(), f->get_results().begin(), f->get_results().end());
+        roots.insert(roots.end(), f->get_sinks().begin(), f->get_sinks().end());
+        roots.insert(roots.end(), f->get_parameters().begin(), f->get_parameters().end());
+        return topological_sort(roots);
+    }
+
+    bool contains(const NodeVector& nodes, const shared_ptr<Node>& node)
+    {
+        return find(nodes.begin(), nodes.end(), node) != nodes.end();
+    }
+}
+
+TEST(function, ordered_ops_are_cached)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto arg1 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<opset5::Add>(arg0, arg1);
+    auto f = make_shared<Function>(add, ParameterVector{arg0, arg1});
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops, f->get_ordered_ops());
+    EXPECT_EQ(ordered_ops, sorted_from_scratch(f));
+}
+
+TEST(function, ordered_ops_after_replace_node)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto arg1 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<opset5::Add>(arg0, arg1);
+    auto relu = make_shared<opset5::Relu>(add);
+    auto f = make_shared<Function>(relu, ParameterVector{arg0, arg1});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), add));
+
+    auto mul = make_shared<opset5::Multiply>(arg0, arg1);
+    replace_node(add, mul);
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_FALSE(contains(ordered_ops, add));
+    EXPECT_TRUE(contains(ordered_ops, mul));
+    EXPECT_EQ(ordered_ops, sorted_from_scratch(f));
+}
+
+TEST(function, ordered_ops_after_input_change)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto f = make_shared<Function>(relu, ParameterVector{arg0});
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+
+    auto abs = make_shared<opset5::Abs>(arg0);
+    relu->input(0).replace_source_output(abs);
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_TRUE(contains(ordered_ops, abs));
+    EXPECT_EQ(ordered_ops, sorted_from_scratch(f));
+}
+
+TEST(function, ordered_ops_after_control_dependency_change)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto f = make_shared<Function>(relu, ParameterVector{arg0});
+    f->get_ordered_ops();
+
+    auto abs = make_shared<opset5::Abs>(arg0);
+    relu->add_control_dependency(abs);
+    EXPECT_TRUE(contains(f->get_ordered_ops(), abs));
+
+    relu->remove_control_dependency(abs);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+}
+
+TEST(function, ordered_ops_after_results_change)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto f = make_shared<Function>(relu, ParameterVector{arg0});
+    f->get_ordered_ops();
+
+    auto abs = make_shared<opset5::Abs>(arg0);
+    auto result = make_shared<opset5::Result>(abs);
+    f->add_results({result});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), abs));
+
+    f->remove_result(result);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+}
+
+TEST(function, ordered_ops_of_shared_nodes)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto f0 = make_shared<Function>(relu, ParameterVector{arg0});
+    auto f1 = make_shared<Function>(relu, ParameterVector{arg0});
+    f0->get_ordered_ops();
+    f1->get_ordered_ops();
+
+    auto abs = make_shared<opset5::Abs>(arg0);
+    relu->input(0).replace_source_output(abs);
+    EXPECT_TRUE(contains(f0->get_ordered_ops(), abs));
+    EXPECT_TRUE(contains(f1->get_ordered_ops(), abs));
+}
+
+TEST(function, ordered_ops_of_shared_nodes_concurrently)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    vector<shared_ptr<Node>> heads;
+    vector<shared_ptr<Node>> anchors;
+    vector<shared_ptr<Function>> functions;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        heads.push_back(make_shared<opset5::Abs>(relu));
+        anchors.push_back(opset5::Constant::create(element::f32, Shape{}, {0.f}));
+        functions.push_back(make_shared<Function>(heads.back(), ParameterVector{arg0}));
+    }
+
+    // Each thread changes only its own nodes, so every sort registers the function on the
+    // shared ones again while the other function does the same.
+    vector<thread> threads;
+    for (size_t i = 0; i < functions.size(); ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (size_t j = 0; j < 1000; ++j)
+            {
+                heads[i]->add_control_dependency(anchors[i]);
+                EXPECT_TRUE(contains(functions[i]->get_ordered_ops(), anchors[i]));
+                heads[i]->remove_control_dependency(anchors[i]);
+                EXPECT_FALSE(contains(functions[i]->get_ordered_ops(), anchors[i]));
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    auto abs = make_shared<opset5::Abs>(arg0);
+    relu->input(0).replace_source_output(abs);
+    for (auto& f : functions)
+    {
+        EXPECT_FALSE(f->get_ordered_ops_cache()->is_valid());
+        EXPECT_EQ(f->get_ordered_ops(), sorted_from_scratch(f));
+    }
+}
+
+TEST(function, ordered_ops_cache_dies_with_function)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto f0 = make_shared<Function>(relu, ParameterVector{arg0});
+    f0->get_ordered_ops();
+
+    weak_ptr<OrderedOpsCache> cache;
+    {
+        auto f1 = make_shared<Function>(relu, ParameterVector{arg0});
+        f1->get_ordered_ops();
+        cache = f1->get_ordered_ops_cache();
+        ASSERT_FALSE(cache.expired());
+    }
+    // the ops outlive the function, but do not keep its cache alive
+    EXPECT_TRUE(cache.expired());
+
+    // the cache of the live function is still notified
+    auto abs = make_shared<opset5::Abs>(arg0);
+    relu->input(0).replace_source_output(abs);
+    EXPECT_FALSE(f0->get_ordered_ops_cache()->is_valid());
+    EXPECT_TRUE(contains(f0->get_ordered_ops(), abs));
+}
+
+TEST(function, ordered_ops_of_large_graph_during_transformations)
+{
+    // a long chain with constant branches, so that constant folding rewrites the graph many times
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = arg;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        auto c0 = opset5::Constant::create(element::f32, Shape{1, 16}, {1.f});
+        auto c1 = opset5::Constant::create(element::f32, Shape{1, 16}, {2.f});
+        auto folded = make_shared<opset5::Multiply>(c0, c1);
+        last = make_shared<opset5::Add>(last, folded);
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops().size(), 2 + 2000 * 4);
+
+    pass::Manager manager;
+    manager.register_pass<pass::ConstantFolding>();
+    manager.run_passes(f);
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops.size(), 2 + 2000 * 2);
+    EXPECT_EQ(ordered_ops, sorted_from_scratch(f));
+}
+
+TEST(benchmark, ordered_ops_in_pass_pipeline)
+{
+    // a synthetic graph of the size of large transformer IRs
+    const size_t num_blocks = 10000;
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = arg;
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        auto c0 = opset5::Constant::create(element::f32, Shape{1, 16}, {1.f});
+        auto c1 = opset5::Constant::create(element::f32, Shape{1, 16}, {2.f});
+        auto folded = make_shared<opset5::Multiply>(c0, c1);
+        last = make_shared<opset5::Relu>(make_shared<opset5::Add>(last, folded));
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{arg});
+    NGRAPH_INFO << "graph size " << f->get_ordered_ops().size() << " nodes";
+
+    {
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < 100; ++i)
+        {
+            f->get_ordered_ops();
+        }
+        timer.stop();
+        NGRAPH_INFO << "100 x get_ordered_ops " << timer.get_milliseconds() << "ms";
+    }
+
+    {
+        pass::Manager manager;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            manager.register_pass<pass::ConstantFolding>();
+        }
+        stopwatch timer;
+        timer.start();
+        manager.run_passes(f);
+        timer.stop();
+        NGRAPH_INFO << "20 x ConstantFolding + Validate " << timer.get_milliseconds() << "ms";
+    }
+}
+
+TEST(function, constructed_nodes_do_not_need_revalidation)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto arg1 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<opset5::Add>(arg0, arg1);
+    auto f = make_shared<Function>(add, ParameterVector{arg0, arg1});
+
+    for (auto& node : f->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->needs_revalidation()) << node;
+    }
+}
+
+TEST(function, validate_changed_nodes_after_input_change)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto neg = make_shared<opset5::Negative>(arg0);
+    auto f = make_shared<Function>(OutputVector{abs, neg}, ParameterVector{arg0});
+
+    auto convert = make_shared<opset5::Convert>(arg0, element::f16);
+    relu->input(0).replace_source_output(convert);
+    EXPECT_TRUE(relu->needs_revalidation());
+    EXPECT_FALSE(abs->needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    // the output type of the changed node has changed, so the consumers are revalidated too
+    EXPECT_EQ(relu->get_output_element_type(0), element::f16);
+    EXPECT_EQ(abs->get_output_element_type(0), element::f16);
+    EXPECT_EQ(f->get_results()[0]->get_output_element_type(0), element::f16);
+    EXPECT_EQ(f->get_results()[1]->get_output_element_type(0), element::f32);
+    for (auto& node : f->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->needs_revalidation()) << node;
+    }
+}
+
+TEST(function, validate_changed_nodes_stops_at_unchanged_outputs)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto f = make_shared<Function>(abs, ParameterVector{arg0});
+
+    auto neg = make_shared<opset5::Negative>(arg0);
+    relu->input(0).replace_source_output(neg);
+    relu->revalidate_and_infer_types();
+    // neither the type nor the shape of the output has changed
+    EXPECT_FALSE(abs->needs_revalidation());
+}
+
+TEST(function, validate_changed_nodes_after_tensor_iterator_body_change)
+{
+    auto X = make_shared<opset5::Parameter>(element::f32, Shape{4, 2});
+    auto Xi = make_shared<opset5::Parameter>(element::f32, Shape{1, 2});
+    auto relu = make_shared<opset5::Relu>(Xi);
+    auto body = make_shared<Function>(OutputVector{relu}, ParameterVector{Xi});
+
+    auto tensor_iterator = make_shared<opset5::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    auto out = tensor_iterator->get_concatenated_slices(body->get_results()[0], 0, 1, 1, -1, 0);
+    auto abs = make_shared<opset5::Abs>(out);
+    auto f = make_shared<Function>(abs, ParameterVector{X});
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(abs->get_output_shape(0), (Shape{4, 2}));
+
+    // the body is rewritten in place, as the passes do, so the TensorIterator itself is not marked
+    auto concat = make_shared<opset5::Concat>(OutputVector{relu, relu}, 1);
+    body->get_results()[0]->input(0).replace_source_output(concat);
+    EXPECT_FALSE(tensor_iterator->needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(tensor_iterator->get_output_shape(0), (Shape{4, 4}));
+    EXPECT_EQ(abs->get_output_shape(0), (Shape{4, 4}));
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), (Shape{4, 4}));
+}
+
+TEST(function, validate_changed_nodes_after_parameter_change)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto shape_of = make_shared<opset5::ShapeOf>(arg0);
+    auto zero = opset5::Constant::create(element::f32, Shape{}, {0.f});
+    auto broadcast = make_shared<opset5::Broadcast>(zero, shape_of);
+    auto f = make_shared<Function>(broadcast, ParameterVector{arg0});
+
+    arg0->set_partial_shape(Shape{3, 4});
+    EXPECT_TRUE(arg0->needs_revalidation());
+    arg0->revalidate_and_infer_types();
+    EXPECT_TRUE(shape_of->needs_revalidation());
+    shape_of->revalidate_and_infer_types();
+    // the shape of ShapeOf output is the same, but its values are not
+    EXPECT_EQ(shape_of->get_output_shape(0), (Shape{2}));
+    EXPECT_TRUE(broadcast->needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_FALSE(broadcast->needs_revalidation());
+}
+
+TEST(function, validate_changed_nodes_after_output_type_attribute_change)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 3});
+    auto shape_of = make_shared<opset5::ShapeOf>(arg0);
+    auto convert = make_shared<opset5::Convert>(arg0, element::f16);
+    auto top_k = make_shared<opset5::TopK>(
+        arg0, opset5::Constant::create(element::i64, Shape{}, {1}), 1, "max", "value");
+    auto f = make_shared<Function>(
+        OutputVector{shape_of, convert, top_k->output(1)}, ParameterVector{arg0});
+
+    // the attributes define the output types, so the setters mark the ops
+    shape_of->set_output_type(element::i32);
+    convert->set_convert_element_type(element::i8);
+    top_k->set_index_element_type(element::i64);
+    EXPECT_TRUE(shape_of->needs_revalidation());
+    EXPECT_TRUE(convert->needs_revalidation());
+    EXPECT_TRUE(top_k->needs_revalidation());
+
+    f->validate_changed_nodes_and_infer_types();
+    EXPECT_EQ(f->get_results()[0]->get_output_element_type(0), element::i32);
+    EXPECT_EQ(f->get_results()[1]->get_output_element_type(0), element::i8);
+    EXPECT_EQ(f->get_results()[2]->get_output_element_type(0), element::i64);
+}
+
+TEST(function, validate_pass_revalidates_changed_nodes)
+{
+    auto arg0 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg0);
+    auto f = make_shared<Function>(relu, ParameterVector{arg0});
+
+    arg0->set_element_type(element::f16);
+
+    pass::Validate().run_on_function(f);
+    EXPECT_EQ(f->get_output_element_type(0), element::f16);
+}
+
+TEST(benchmark, incremental_validation)
+{
+    const size_t num_blocks = 10000;
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = arg;
+    NodeVector relus;
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        auto c = opset5::Constant::create(element::f32, Shape{1, 16}, {1.f});
+        relus.push_back(make_shared<opset5::Relu>(make_shared<opset5::Add>(last, c)));
+        last = relus.back();
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{arg});
+
+    {
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < 100; ++i)
+        {
+            relus[i * 100]->input(0).replace_source_output(relus[i * 100]->input_value(0));
+            f->validate_nodes_and_infer_types();
+        }
+        timer.stop();
+        NGRAPH_INFO << "100 x full validation " << timer.get_milliseconds() << "ms";
+    }
+
+    {
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < 100; ++i)
+        {
+            relus[i * 100]->input(0).replace_source_output(relus[i * 100]->input_value(0));
+            f->validate_changed_nodes_and_infer_types();
+        }
+        timer.stop();
+        NGRAPH_INFO << "100 x incremental validation " << timer.get_milliseconds() << "ms";
+    }
+}
+
+TEST(benchmark, clone_and_destroy_function)
+{
+    // a synthetic graph of the size of large transformer IRs
+    const size_t num_blocks = 10000;
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = arg;
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        auto c = opset5::Constant::create(element::f32, Shape{1, 16}, {1.f});
+        last = make_shared<opset5::Relu>(make_shared<opset5::Add>(last, c));
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{arg});
+    NGRAPH_INFO << "graph size " << f->get_ordered_ops().size() << " nodes";
+
+    stopwatch clone_timer;
+    stopwatch destroy_timer;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        clone_timer.start();
+        auto cloned = clone_function(*f);
+        clone_timer.stop();
+        destroy_timer.start();
+        cloned.reset();
+        destroy_timer.stop();
+    }
+    NGRAPH_INFO << "10 x clone " << clone_timer.get_total_milliseconds() << "ms, destroy "
+                << destroy_timer.get_total_milliseconds() << "ms";
+}
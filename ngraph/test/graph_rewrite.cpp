@@ -6,6 +6,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 using namespace ::testing;
@@ -265,6 +267,121 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+class ReplaceWithRelu : public ngraph::pass::MatcherPass
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ReplaceWithRelu(const std::shared_ptr<Node>& root)
+        : MatcherPass()
+    {
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto relu = std::make_shared<ngraph::opset3::Relu>(m.get_match_root()->input_value(0));
+            ngraph::replace_node(m.get_match_root(), relu);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(root, "ReplaceWithRelu");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(ReplaceWithRelu, "ReplaceWithRelu", 0);
+
+TEST(GraphRewriteTest, OrRootMatcherPass)
+{
+    auto f = get_function();
+
+    Anchor anchor;
+    anchor.add_matcher<ReplaceWithRelu>(std::make_shared<pattern::op::Or>(
+        OutputVector{pattern::wrap_type<opset3::Multiply>(), pattern::wrap_type<opset3::Divide>()}));
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, MixedRootMatcherPassOrder)
+{
+    auto label_root = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{}, pattern::has_class<opset3::Divide>());
+    {
+        auto f = get_function();
+
+        Anchor anchor;
+        anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+        anchor.add_matcher<ReplaceWithRelu>(label_root);
+        anchor.run_on_function(f);
+
+        ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 0);
+        ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    }
+    {
+        auto f = get_derived_function();
+
+        Anchor anchor;
+        anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+        anchor.add_matcher<ReplaceWithRelu>(label_root);
+        anchor.run_on_function(f);
+
+        ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+        ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+    }
+}
+
+TEST(GraphRewriteTest, MatcherPassSkippedOnInputsNumberMismatch)
+{
+    size_t unary_calls = 0;
+    size_t binary_calls = 0;
+    auto unary_root = pattern::wrap_type<opset3::Divide>(
+        {pattern::any_input()}, [&](const Output<Node>&) { return ++unary_calls == 0; });
+    auto binary_root = pattern::wrap_type<opset3::Divide>(
+        {pattern::any_input(), pattern::any_input()},
+        [&](const Output<Node>&) { return ++binary_calls == 0; });
+
+    auto f = get_function();
+
+    Anchor anchor;
+    anchor.add_matcher<ReplaceWithRelu>(unary_root);
+    anchor.add_matcher<ReplaceWithRelu>(binary_root);
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(unary_calls, 0);
+    ASSERT_EQ(binary_calls, 1);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 0);
+}
+
+TEST(benchmark, graph_rewrite_dispatch)
+{
+    const size_t num_blocks = 10000;
+    auto arg = std::make_shared<opset3::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = arg;
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        auto c = opset3::Constant::create(element::f32, Shape{1, 16}, {1.f});
+        last = std::make_shared<opset3::Relu>(std::make_shared<opset3::Add>(last, c));
+    }
+    auto f = std::make_shared<Function>(OutputVector{last}, ParameterVector{arg});
+
+    // a pipeline of the size of common optimizations where a single pass has a generic root
+    Anchor anchor;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        anchor.add_matcher<ReplaceWithRelu>(pattern::wrap_type<opset3::Divide>(
+            {pattern::any_input(), pattern::any_input()}));
+    }
+    anchor.add_matcher<ReplaceWithRelu>(std::make_shared<pattern::op::Label>(
+        element::f32, Shape{}, pattern::has_class<opset3::Divide>()));
+
+    stopwatch timer;
+    timer.start();
+    for (size_t i = 0; i < 10; ++i)
+    {
+        anchor.run_on_function(f);
+    }
+    timer.stop();
+    NGRAPH_INFO << "10 x GraphRewrite with 201 matchers on " << f->get_ordered_ops().size()
+                << " nodes " << timer.get_milliseconds() << "ms";
+}
+
 TEST(PassConfigTest, Test1)
 {
     {
@@ -19,8 +19,10 @@
 #include <cstdint>
 #include <fstream>
 #include <iterator>
+#include <functional>
 #include <limits>
 #include <numeric>
+#include <onnx/onnx_pb.h>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
@@ -3238,3 +3240,69 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_hard_sigmoid)
     test_case.add_expected_output<float>(Shape{4}, {1.0f, 0.0f, 0.5f, 0.699999988079071f});
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_many_large_initializers)
+{
+    // Large enough for the initializers to be decoded on several threads
+    const std::size_t initializers_count = 8;
+    const Shape shape{256, 512};
+    const auto size = shape_size(shape);
+
+    ONNX_NAMESPACE::ModelProto model_proto;
+    model_proto.set_ir_version(7);
+    model_proto.add_opset_import()->set_version(12);
+    auto graph_proto = model_proto.mutable_graph();
+    graph_proto->set_name("many_large_initializers");
+    auto sum = graph_proto->add_node();
+    sum->set_op_type("Sum");
+    sum->add_output("Y");
+
+    std::vector<float> expected(size, 0.f);
+    for (std::size_t i = 0; i < initializers_count; ++i)
+    {
+        const auto name = "W" + std::to_string(i);
+        std::vector<float> data(size);
+        std::iota(data.begin(), data.end(), static_cast<float>(i));
+        std::transform(
+            expected.begin(), expected.end(), data.begin(), expected.begin(), std::plus<float>());
+
+        auto tensor = graph_proto->add_initializer();
+        tensor->set_name(name);
+        tensor->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        for (const auto dim : shape)
+        {
+            tensor->add_dims(dim);
+        }
+        // Alternate between the raw and the typed storage of tensor data
+        if (i % 2 == 0)
+        {
+            tensor->set_raw_data(std::string(reinterpret_cast<const char*>(data.data()),
+                                             data.size() * sizeof(float)));
+        }
+        else
+        {
+            for (const auto value : data)
+            {
+                tensor->add_float_data(value);
+            }
+        }
+        sum->add_input(name);
+    }
+
+    auto output = graph_proto->add_output();
+    output->set_name("Y");
+    auto tensor_type = output->mutable_type()->mutable_tensor_type();
+    tensor_type->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    for (const auto dim : shape)
+    {
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+
+    std::stringstream model_stream;
+    model_proto.SerializeToOstream(&model_stream);
+    auto function = onnx_import::import_onnx_model(model_stream);
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_expected_output<float>(shape, expected);
+    test_case.run();
+}
@@ -14,9 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "onnx_import/core/tensor.hpp"
 #include "onnx_import/default_opset.hpp"
 #include "onnx_import/onnx.hpp"
 #include "util/engine/test_engines.hpp"
@@ -33,6 +39,33 @@ static std::string s_manifest = "${MANIFEST}";
 
 using TestEngine = test::ENGINE_CLASS_NAME(${BACKEND_NAME});
 
+namespace
+{
+    // Checks that the address belongs to a memory mapping of the file with the given name
+    bool is_mapped_from_file(const void* address, const std::string& file_name)
+    {
+        std::ifstream maps{"/proc/self/maps"};
+        const auto value = reinterpret_cast<std::uintptr_t>(address);
+        std::string line;
+        while (std::getline(maps, line))
+        {
+            std::istringstream fields{line};
+            std::string range, permissions, offset, device, inode, path;
+            fields >> range >> permissions >> offset >> device >> inode >> path;
+            const auto dash = range.find('-');
+            const auto begin = std::stoull(range.substr(0, dash), nullptr, 16);
+            const auto end = std::stoull(range.substr(dash + 1), nullptr, 16);
+            if (begin <= value && value < end)
+            {
+                return path.size() >= file_name.size() &&
+                       path.compare(path.size() - file_name.size(), file_name.size(), file_name) ==
+                           0;
+            }
+        }
+        return false;
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data)
 {
     const auto function = onnx_import::import_onnx_model(
@@ -122,6 +155,26 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_out_of_file_exception)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_out_of_file.prototxt"));
+        FAIL() << "External data exceeding the file size not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 8, data_lenght: 16, sha1_digest: 0)"),
+                            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_up_dir_path)
 {
     try
@@ -155,3 +208,47 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path)
 
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_initializer_constant_aliases_raw_data)
+{
+    auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
+    auto tensor_proto = model_proto->mutable_graph()->add_initializer();
+    tensor_proto->set_name("A");
+    tensor_proto->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    tensor_proto->add_dims(2);
+    tensor_proto->add_dims(2);
+    const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+    tensor_proto->set_raw_data(values.data(), values.size() * sizeof(float));
+
+    const auto constant = onnx_import::Tensor{*tensor_proto, model_proto}.get_ng_constant();
+    EXPECT_EQ(constant->get_data_ptr(), static_cast<const void*>(tensor_proto->raw_data().data()));
+
+    // the tensor without the owning model is copied
+    const auto copied = onnx_import::Tensor{*tensor_proto}.get_ng_constant();
+    EXPECT_NE(copied->get_data_ptr(), static_cast<const void*>(tensor_proto->raw_data().data()));
+
+    // the Constant keeps the model alive
+    model_proto.reset();
+    EXPECT_EQ(constant->cast_vector<float>(), values);
+    EXPECT_EQ(copied->cast_vector<float>(), values);
+}
+
+#ifdef __linux__
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_constant_aliases_mapped_file)
+{
+    ONNX_NAMESPACE::TensorProto tensor_proto;
+    tensor_proto.set_name("A");
+    tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    tensor_proto.add_dims(2);
+    tensor_proto.add_dims(2);
+    tensor_proto.set_data_location(ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL);
+    auto location = tensor_proto.add_external_data();
+    location->set_key("location");
+    location->set_value(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/tensors_data/tensor.data"));
+
+    const auto constant = onnx_import::Tensor{tensor_proto}.get_ng_constant();
+    EXPECT_TRUE(is_mapped_from_file(constant->get_data_ptr(), "tensor.data"));
+    EXPECT_EQ(constant->cast_vector<float>(), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+}
+#endif
@@ -16,8 +16,13 @@
 
 #include "int_executable.hpp"
 #include <cstring>
+#include <future>
+#include <map>
+#include <thread>
+#include <unordered_set>
 #include "backend_manager.hpp"
 #include "ngraph/chrome_trace.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/op/util/op_types.hpp"
 #include "ngraph/ops.hpp"
@@ -46,6 +51,10 @@ namespace
     constexpr size_t score_threshold_port = 4;
     constexpr size_t soft_nms_sigma_port = 5;
 
+    // Waves producing fewer elements are executed sequentially, as starting threads would
+    // cost more than the ops themselves
+    constexpr size_t min_parallel_wave_work = 1 << 16;
+
     PartialShape
         infer_selected_indices_shape(const std::vector<std::shared_ptr<HostTensor>>& inputs,
                                      int64_t max_output_boxes_per_class)
@@ -275,133 +284,393 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    m_parallel_enabled = !getenv_bool("NGRAPH_INTERPRETER_DISABLE_PARALLEL");
+    compile();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::compile()
 {
-    event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (const auto& tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (const auto& tensor : outputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
-    }
+    // Assign a slot to every tensor produced in the function
+    unordered_map<descriptor::Tensor*, size_t> tensor_slots;
+    auto get_slot = [&](descriptor::Tensor* tensor) {
+        auto it = tensor_slots.find(tensor);
+        if (it == tensor_slots.end())
+        {
+            it = tensor_slots.emplace(tensor, m_slot_count++).first;
+        }
+        return it->second;
+    };
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
     for (const auto& param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            m_parameter_slots.push_back(get_slot(&param->output(i).get_tensor()));
         }
     }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    for (const auto& result : get_results())
     {
-        auto output = get_results()[output_count];
-        if (!is_type<op::Result>(output))
+        if (!is_type<op::Result>(result))
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->get_output_tensor(0);
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        m_result_slots.push_back(get_slot(&result->get_output_tensor(0)));
     }
+    unordered_set<size_t> persistent_slots(m_parameter_slots.begin(), m_parameter_slots.end());
+    persistent_slots.insert(m_result_slots.begin(), m_result_slots.end());
 
-    // for each ordered op in the graph
+    // Group ops into waves: an op is executed in the wave after the last of its dependencies
+    unordered_map<const Node*, size_t> op_wave;
+    vector<size_t> first_use;
+    vector<size_t> last_use;
     for (const auto& op : m_nodes)
     {
-        event::Duration d2(op->description(), "Interpreter");
-        if (op::is_parameter(op))
+        size_t wave = 0;
+        if (op::is_parameter(op) || op::is_constant(op))
         {
+            for (size_t i = 0; i < op->get_output_size(); ++i)
+            {
+                const size_t slot = get_slot(&op->output(i).get_tensor());
+                if (auto constant = as_type_ptr<op::Constant>(op))
+                {
+                    m_constant_slots.emplace_back(
+                        slot,
+                        make_shared<HostTensor>(constant->get_output_element_type(0),
+                                                constant->get_output_shape(0),
+                                                const_cast<void*>(constant->get_data_ptr()),
+                                                constant->output(0).get_tensor().get_name()));
+                    persistent_slots.insert(slot);
+                }
+            }
+            op_wave[op.get()] = wave;
             continue;
         }
+        for (const auto& input : op->input_values())
+        {
+            wave = max(wave, op_wave.at(input.get_node()) + 1);
+        }
+        for (const auto& dependency : op->get_control_dependencies())
+        {
+            wave = max(wave, op_wave.at(dependency.get()) + 1);
+        }
+        wave = max<size_t>(wave, 1);
+        op_wave[op.get()] = wave;
+        if (m_waves.size() < wave)
+        {
+            m_waves.resize(wave);
+        }
 
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
+        ExecutionStep step;
+        step.node = op;
+        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::PriorBox>(op))
+        {
+            step.type = op->get_input_element_type(0);
+        }
+        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
+                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
+        {
+            // Get the type of the second input, not the first
+            // All BinaryElementwiseComparision ops have the same type for inputs
+            // Select has bool for first input and the type we are interested in for the second
+            step.type = op->get_input_element_type(1);
+        }
+        else
+        {
+            step.type = op->get_output_element_type(0);
+        }
         for (auto input : op->inputs())
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            step.input_slots.push_back(get_slot(&input.get_tensor()));
         }
-
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            step.output_slots.push_back(get_slot(&op->output(i).get_tensor()));
+        }
+        if (m_performance_counters_enabled)
+        {
+            step.timer = &m_timer_map[op];
+        }
+
+        // Record when every intermediate tensor is produced and last read
+        first_use.resize(m_slot_count, 0);
+        last_use.resize(m_slot_count, 0);
+        for (size_t slot : step.input_slots)
+        {
+            last_use[slot] = max(last_use[slot], wave);
+        }
+        for (size_t i = 0; i < step.output_slots.size(); ++i)
+        {
+            const size_t slot = step.output_slots[i];
+            first_use[slot] = wave;
+            last_use[slot] = max(last_use[slot], wave);
+            if (op->get_output_partial_shape(i).is_static())
             {
-                host_tensor = make_shared<HostTensor>(op->output(i));
-                tensor_map.insert({tensor, host_tensor});
+                m_waves[wave - 1].work += shape_size(op->get_output_shape(i));
             }
-            else
+        }
+        m_waves[wave - 1].steps.push_back(move(step));
+    }
+    first_use.resize(m_slot_count, 0);
+    last_use.resize(m_slot_count, 0);
+
+    m_planned_tensors.resize(m_slot_count);
+    for (const auto& wave : m_waves)
+    {
+        for (const auto& step : wave.steps)
+        {
+            for (size_t i = 0; i < step.output_slots.size(); ++i)
             {
-                host_tensor = it->second;
+                const size_t slot = step.output_slots[i];
+                if (persistent_slots.count(slot) != 0)
+                {
+                    continue;
+                }
+                m_waves[last_use[slot] - 1].released_slots.push_back(slot);
+                const auto& output = step.node->output(i);
+                if (output.get_partial_shape().is_static() &&
+                    output.get_element_type().is_static())
+                {
+                    auto& planned = m_planned_tensors[slot];
+                    planned.is_planned = true;
+                    planned.type = output.get_element_type();
+                    planned.shape = output.get_shape();
+                }
             }
-            op_outputs.push_back(host_tensor);
         }
+    }
+    plan_memory(first_use, last_use);
+}
 
-        // get op type
-        element::Type type;
-        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::PriorBox>(op))
+void runtime::interpreter::INTExecutable::plan_memory(const vector<size_t>& first_use,
+                                                      const vector<size_t>& last_use)
+{
+    // Replay allocations and releases wave by wave against a best fit free list, so that
+    // tensors whose lifetimes do not overlap share memory. Tensors produced and read in the
+    // same wave are alive at the same time, which keeps inputs and outputs of an op (and of
+    // concurrently executed ops) apart.
+    const size_t alignment = get_alignment();
+    auto aligned_size = [&](size_t slot) {
+        const auto& planned = m_planned_tensors[slot];
+        const size_t size = shape_size(planned.shape) * planned.type.size();
+        return (size + alignment - 1) / alignment * alignment;
+    };
+
+    map<size_t, size_t> free_blocks;
+    auto allocate = [&](size_t size) {
+        auto best = free_blocks.end();
+        for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it)
         {
-            type = op->get_input_element_type(0);
+            if (it->second >= size && (best == free_blocks.end() || it->second < best->second))
+            {
+                best = it;
+            }
         }
-        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
-                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
+        if (best != free_blocks.end())
         {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            const size_t offset = best->first;
+            const size_t remaining = best->second - size;
+            free_blocks.erase(best);
+            if (remaining > 0)
+            {
+                free_blocks[offset + size] = remaining;
+            }
+            return offset;
+        }
+        // Grow the arena, reusing a free block at its end
+        size_t offset = m_arena_size;
+        if (!free_blocks.empty() &&
+            free_blocks.rbegin()->first + free_blocks.rbegin()->second == m_arena_size)
+        {
+            offset = free_blocks.rbegin()->first;
+            free_blocks.erase(offset);
+        }
+        m_arena_size = offset + size;
+        return offset;
+    };
+    auto release = [&](size_t offset, size_t size) {
+        auto next = free_blocks.lower_bound(offset);
+        if (next != free_blocks.end() && offset + size == next->first)
+        {
+            size += next->second;
+            free_blocks.erase(next);
+        }
+        auto prev = free_blocks.lower_bound(offset);
+        if (prev != free_blocks.begin() && (--prev)->first + prev->second == offset)
+        {
+            prev->second += size;
         }
         else
         {
-            type = op->get_output_element_type(0);
+            free_blocks[offset] = size;
         }
+    };
 
-        if (m_performance_counters_enabled)
+    for (size_t wave = 1; wave <= m_waves.size(); ++wave)
+    {
+        for (const auto& step : m_waves[wave - 1].steps)
         {
-            m_timer_map[op].start();
+            for (size_t slot : step.output_slots)
+            {
+                if (m_planned_tensors[slot].is_planned && first_use[slot] == wave)
+                {
+                    m_planned_tensors[slot].offset = allocate(aligned_size(slot));
+                }
+            }
         }
-        if (!op->evaluate(op_outputs, op_inputs))
+        for (size_t slot : m_waves[wave - 1].released_slots)
         {
-            generate_calls(type, *op, op_outputs, op_inputs);
+            if (m_planned_tensors[slot].is_planned && last_use[slot] == wave)
+            {
+                release(m_planned_tensors[slot].offset, aligned_size(slot));
+            }
         }
-        if (m_performance_counters_enabled)
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    event::Duration d1("call", "Interpreter");
+
+    // convert inputs to HostTensor
+    vector<shared_ptr<HostTensor>> func_inputs;
+    for (const auto& tensor : inputs)
+    {
+        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
+        func_inputs.push_back(host_tensor);
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(func_inputs);
+    }
+
+    // bind function params, outputs and constants to their slots
+    vector<shared_ptr<HostTensor>> slots(m_slot_count);
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i)
+    {
+        slots[m_parameter_slots[i]] = func_inputs[i];
+    }
+    for (size_t i = 0; i < m_result_slots.size(); ++i)
+    {
+        slots[m_result_slots[i]] = static_pointer_cast<runtime::HostTensor>(outputs[i]);
+    }
+    for (const auto& constant : m_constant_slots)
+    {
+        slots[constant.first] = constant.second;
+    }
+
+    // all static intermediate tensors live in one buffer laid out by plan_memory
+    AlignedBuffer arena(m_arena_size, get_alignment());
+
+    for (const auto& wave : m_waves)
+    {
+        // create outputs before the ops are launched, so that workers only read slots
+        for (const auto& step : wave.steps)
         {
-            m_timer_map[op].stop();
+            for (size_t i = 0; i < step.output_slots.size(); ++i)
+            {
+                const size_t slot = step.output_slots[i];
+                if (slots[slot])
+                {
+                    continue;
+                }
+                const auto& planned = m_planned_tensors[slot];
+                slots[slot] =
+                    planned.is_planned
+                        ? make_shared<HostTensor>(
+                              planned.type, planned.shape, arena.get_ptr(planned.offset))
+                        : make_shared<HostTensor>(step.node->output(i));
+            }
+        }
+
+        const size_t threads =
+            min<size_t>(wave.steps.size(), max(1u, thread::hardware_concurrency()));
+        if (m_parallel_enabled && threads > 1 && wave.work >= min_parallel_wave_work)
+        {
+            vector<future<void>> workers;
+            for (size_t t = 0; t < threads; ++t)
+            {
+                workers.push_back(async(launch::async, [&, t]() {
+                    for (size_t i = t; i < wave.steps.size(); i += threads)
+                    {
+                        execute_step(wave.steps[i], slots);
+                    }
+                }));
+            }
+            // wait for all workers before rethrowing, they use the slots of this call
+            exception_ptr error;
+            for (auto& worker : workers)
+            {
+                try
+                {
+                    worker.get();
+                }
+                catch (...)
+                {
+                    if (!error)
+                    {
+                        error = current_exception();
+                    }
+                }
+            }
+            if (error)
+            {
+                rethrow_exception(error);
+            }
+        }
+        else
+        {
+            for (const auto& step : wave.steps)
+            {
+                execute_step(step, slots);
+            }
         }
-        if (m_nan_check_enabled)
+
+        // free intermediate tensors after their last use
+        for (size_t slot : wave.released_slots)
         {
-            perform_nan_check(op_outputs, op.get());
+            slots[slot].reset();
         }
     }
 
     return true;
 }
 
+void runtime::interpreter::INTExecutable::execute_step(const ExecutionStep& step,
+                                                       vector<shared_ptr<HostTensor>>& slots)
+{
+    const auto& op = step.node;
+    event::Duration d2(op->description(), "Interpreter");
+
+    vector<shared_ptr<HostTensor>> op_inputs;
+    for (size_t slot : step.input_slots)
+    {
+        op_inputs.push_back(slots[slot]);
+    }
+    vector<shared_ptr<HostTensor>> op_outputs;
+    for (size_t slot : step.output_slots)
+    {
+        op_outputs.push_back(slots[slot]);
+    }
+
+    if (step.timer)
+    {
+        step.timer->start();
+    }
+    if (!op->evaluate(op_outputs, op_inputs))
+    {
+        generate_calls(step.type, *op, op_outputs, op_inputs);
+    }
+    if (step.timer)
+    {
+        step.timer->stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(op_outputs, op.get());
+    }
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const Node& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
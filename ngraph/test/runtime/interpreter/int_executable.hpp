@@ -148,6 +148,10 @@ public:
 
     std::vector<PerformanceCounter> get_performance_data() const override;
 
+    /// \brief Size of the buffer that holds static shape intermediate tensors during a call.
+    ///        Tensors with disjoint lifetimes share memory in it.
+    size_t get_intermediate_memory_size() const { return m_arena_size; }
+
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
     std::shared_ptr<runtime::Tensor> create_output_tensor(size_t output_index) override;
@@ -170,6 +174,50 @@ protected:
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::set<std::string> m_unsupported_op_name_list;
 
+    /// \brief Op with its input and output tensors resolved to slots at compile time
+    struct ExecutionStep
+    {
+        std::shared_ptr<Node> node;
+        /// \brief Element type used to instantiate the reference implementation
+        element::Type type;
+        std::vector<size_t> input_slots;
+        std::vector<size_t> output_slots;
+        stopwatch* timer = nullptr;
+    };
+
+    /// \brief Ops that do not depend on each other and can be executed concurrently
+    struct ExecutionWave
+    {
+        std::vector<ExecutionStep> steps;
+        /// \brief Slots of intermediate tensors that are not used after this wave
+        std::vector<size_t> released_slots;
+        /// \brief Number of output elements produced by the wave
+        size_t work = 0;
+    };
+
+    /// \brief Static shape intermediate tensor placed in the memory arena of a call
+    struct PlannedTensor
+    {
+        bool is_planned = false;
+        element::Type type;
+        Shape shape;
+        size_t offset = 0;
+    };
+
+    void compile();
+    void plan_memory(const std::vector<size_t>& first_use, const std::vector<size_t>& last_use);
+    void execute_step(const ExecutionStep& step, std::vector<std::shared_ptr<HostTensor>>& slots);
+
+    size_t m_slot_count = 0;
+    std::vector<size_t> m_parameter_slots;
+    std::vector<size_t> m_result_slots;
+    /// \brief Constant outputs are bound to the constant data instead of being copied
+    std::vector<std::pair<size_t, std::shared_ptr<HostTensor>>> m_constant_slots;
+    std::vector<PlannedTensor> m_planned_tensors;
+    size_t m_arena_size = 0;
+    std::vector<ExecutionWave> m_waves;
+    bool m_parallel_enabled = true;
+
     static OP_TYPEID get_typeid(const Node& node);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,